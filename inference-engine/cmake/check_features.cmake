@@ -129,6 +129,27 @@ if (NOT GEMM STREQUAL "MKL" AND NOT GEMM STREQUAL "OPENBLAS")
     message("FATAL_ERROR" "GEMM should be set to MKL|OPENBLAS")
 endif()
 
+if (NOT THREADING STREQUAL "OMP" AND NOT THREADING STREQUAL "TBB" AND
+    NOT THREADING STREQUAL "POOL" AND NOT THREADING STREQUAL "SEQ")
+    message(FATAL_ERROR "THREADING should be set to OMP|TBB|POOL|SEQ")
+endif()
+
+if (THREADING STREQUAL "OMP" AND NOT ENABLE_OMP)
+    set(THREADING "SEQ")
+endif()
+
+if (THREADING STREQUAL "TBB")
+    find_path(TBB_INCLUDE_DIRS tbb/tbb.h PATHS $ENV{TBBROOT}/include)
+    find_library(TBB_LIBRARIES tbb PATHS $ENV{TBBROOT}/lib $ENV{TBBROOT}/lib/intel64/gcc4.7)
+    if (NOT TBB_INCLUDE_DIRS OR NOT TBB_LIBRARIES)
+        message(FATAL_ERROR "THREADING = TBB, but TBB was not found. Set TBBROOT environment variable")
+    endif()
+    include_directories(${TBB_INCLUDE_DIRS})
+endif()
+
+add_definitions(-DIE_THREAD=IE_THREAD_${THREADING})
+
 print_enabled_features()
 
 message(STATUS "GEMM = ${GEMM}")
+message(STATUS "THREADING = ${THREADING}")
@@ -26,6 +26,11 @@ if (NOT GEMM)
     set (GEMM "OPENBLAS")
 endif()
 
+# "Threading backend of the CPU plugin and extension layers: OMP|TBB|POOL|SEQ"
+if (NOT THREADING)
+    set (THREADING "OMP")
+endif()
+
 ie_option (ENABLE_OMP "MKL-DNN library based on OMP implementation" ON)
 
 ie_option (ENABLE_INTEL_OMP "MKL-DNN library based on Intel OMP implementation" ON)
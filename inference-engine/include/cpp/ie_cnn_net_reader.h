@@ -68,6 +68,14 @@ public:
         CALL_STATUS_FNC(ReadWeights, filepath.c_str());
     }
 
+    /**
+     * @brief Wraps original method
+     * ICNNNetReader::ReleaseWeights
+     */
+    void ReleaseWeights() const {
+        CALL_STATUS_FNC_NO_ARGS(ReleaseWeights);
+    }
+
     /**
     * @brief Gets a copy of built network object
     * @return A copy of the CNNNetwork object to be loaded
@@ -100,6 +100,16 @@ public:
         CALL_STATUS_FNC(GetMappedTopology, deployedTopology);
     }
 
+    /**
+    * @brief Wraps original method
+    * IExecutableNetwork::GetMemoryInfo
+    */
+    MemoryInfo GetMemoryInfo() {
+        MemoryInfo info;
+        CALL_STATUS_FNC(GetMemoryInfo, info);
+        return info;
+    }
+
     /**
     * cast operator is used when this wrapper initialized by LoadNetwork
     * @return
@@ -112,6 +112,14 @@ public:
         return perfMap;
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::ResetPerformanceCounts
+     */
+    void ResetPerformanceCounts() {
+        CALL_STATUS_FNC_NO_ARGS(ResetPerformanceCounts);
+    }
+
     /**
      * @brief Sets input data to infer
      * @note: Memory allocation doesn't happen
@@ -145,6 +153,14 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetConfig
+     */
+    void SetConfig(const std::map<std::string, std::string> &config) {
+        CALL_STATUS_FNC(SetConfig, config);
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
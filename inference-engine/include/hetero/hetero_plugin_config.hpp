@@ -21,6 +21,7 @@ namespace HeteroConfigParams {
 
 #define HETERO_CONFIG_KEY(name) InferenceEngine::HeteroConfigParams::_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
 /**
@@ -30,5 +31,56 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key enables pipelined execution of subgraphs. Each subgraph is executed by its own worker, so while
+ * a subgraph of a request runs, the previous subgraphs may already run for the next requests. Throughput of many
+ * requests in flight approaches the throughput of the slowest subgraph.
+ * Subgraphs are loaded with KEY_EXCLUSIVE_ASYNC_REQUESTS=NO in this mode unless the key is passed to LoadNetwork.
+ * Performance counters of requests report the total busy and blocked time of each stage as "<pipeline stage N>".
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
+/**
+ * @brief The key sets the maximum number of requests waiting for a subgraph in the pipelined mode.
+ * A subgraph which can't pass a request to the next one waits for room in its queue.
+ * This option should be used with a positive integer value, 4 by default
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_QUEUE_SIZE);
+
+/**
+ * @brief The key selects how layers are assigned to the devices of TARGET_FALLBACK if the network has no affinities.
+ * HETERO_FALLBACK assigns each layer to the first device which supports it.
+ * HETERO_COST assigns the layers so that the sum of their measured execution times and of the times to transfer data
+ * between devices is minimal. The execution times are taken from KEY_HETERO_COST_PROFILE or measured by a profiling
+ * pass, which loads the network once per device and infers it a few times.
+ * This option should be used with values: HETERO_CONFIG_VALUE(FALLBACK) (default) or HETERO_CONFIG_VALUE(COST)
+ */
+DECLARE_HETERO_CONFIG_KEY(AFFINITY_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(FALLBACK);
+DECLARE_HETERO_CONFIG_VALUE(COST);
+
+/**
+ * @brief The key sets the path to a profile of layer execution times for the HETERO_COST policy.
+ * Each line of the file has a device, a time in microseconds and a layer name separated by spaces.
+ * Devices which are missing in the file are profiled and the file is rewritten with their times.
+ * By default the devices are profiled on each LoadNetwork and the times are not saved
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_PROFILE);
+
+/**
+ * @brief The key sets the time in microseconds to pass one megabyte of data between subgraphs on different devices,
+ * used by the HETERO_COST policy. This option should be used with a non-negative number, 100 by default
+ */
+DECLARE_HETERO_CONFIG_KEY(TRANSFER_COST);
+
+/**
+ * @brief The key limits the number of subgraphs the HETERO_COST policy splits the network into.
+ * The limit applies to segments of the topologically sorted layers, so layers of a segment which are not connected
+ * may still be loaded as separate subgraphs.
+ * This option should be used with a non-negative integer value, 0 (default) means no limit
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -299,6 +299,16 @@ public:
         allocate();
     }
 
+    /**
+     * @brief Creates a TBlob object with the specified dimensions, layout and custom memory allocator
+     * but does not allocate the memory. Please use the allocate() method to allocate memory.
+     * @param tensorDesc Tensor description
+     * @param alloc Allocator to be used
+     */
+    TBlob(const TensorDesc& tensorDesc, const std::shared_ptr<IAllocator>& alloc)
+            : Blob(tensorDesc), _allocator(alloc) {
+    }
+
     /**
      * @deprecated Please use TensorDesc for Blob initialization.
      */
@@ -644,6 +654,19 @@ inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_blob(const TensorD
     return std::make_shared<InferenceEngine::TBlob<Type>>(tensorDesc, ptr, size);
 }
 
+/**
+ * @brief Creates a blob with the given tensor descriptor and custom memory allocator.
+ * @tparam Type Type of the shared pointer to be created
+ * @param tensorDesc Tensor descriptor for Blob creation
+ * @param alloc Shared pointer to IAllocator to use in the blob
+ * @return A shared pointer to the newly created blob of the given type
+ */
+template<typename Type>
+inline typename InferenceEngine::TBlob<Type>::Ptr make_shared_blob(const TensorDesc& tensorDesc,
+                                                                   const std::shared_ptr<IAllocator>& alloc) {
+    return std::make_shared<InferenceEngine::TBlob<Type>>(tensorDesc, alloc);
+}
+
 /**
  * @deprecated Use TensorDesc in order to create Blob::Ptr.
  * @brief Gets a shared pointer for the new TBlob instance.
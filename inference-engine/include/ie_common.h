@@ -135,6 +135,24 @@ struct InferenceEngineProfileInfo {
      * @brief An execution index of the unit
      */
     unsigned execution_index;
+
+    /**
+     * @brief The number of executions the statistics below are collected over, 0 if the plugin doesn't provide them
+     */
+    unsigned long long count = 0;
+
+    /**
+     * @brief The minimum and maximum time in microseconds of a single execution of the layer
+     */
+    long long min_uSec = 0;
+    long long max_uSec = 0;
+
+    /**
+     * @brief The median, 90th and 99th percentiles of the time in microseconds of a single execution of the layer
+     */
+    long long p50_uSec = 0;
+    long long p90_uSec = 0;
+    long long p99_uSec = 0;
 };
 
 
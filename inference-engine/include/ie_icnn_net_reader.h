@@ -98,6 +98,15 @@ public:
      * @return IR version number: 1 or 2
      */
     virtual int getVersion(ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Releases the weights buffer (.bin part) and the weights of all layers of the built network.
+     * Call it after the network is loaded to all plugins with the weights released on their side
+     * (e.g. KEY_CPU_RELEASE_WEIGHTS): the network can't be loaded anymore after the call.
+     * @param resp Response message
+     * @return Result code
+     */
+    virtual StatusCode ReleaseWeights(ResponseDesc *resp) noexcept = 0;
 };
 
 /**
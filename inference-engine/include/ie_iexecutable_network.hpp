@@ -11,6 +11,7 @@
 
 #include "ie_common.h"
 #include "ie_primitive_info.hpp"
+#include "ie_memory_info.hpp"
 #include "ie_iinfer_request.hpp"
 #include "ie_imemory_state.hpp"
 #include "ie_input_info.hpp"
@@ -89,6 +90,14 @@ public:
      * @return Status code of the operation: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
      */
     virtual StatusCode  QueryState(IMemoryState::Ptr & pState, size_t  idx, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Gets the host memory footprint of the executable network
+    * @param info Reference to the MemoryInfo object to fill
+    * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+    * @return Status code of the operation: OK (0) for success
+    */
+    virtual StatusCode GetMemoryInfo(MemoryInfo &info, ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -133,6 +133,24 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets properties of the request, e.g. its scheduling priority (see PluginConfigParams::KEY_REQUEST_PRIORITY).
+    * The properties are applied to the following inference calls of this request.
+    * @param config Map of pairs: (property name, property value)
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual InferenceEngine::StatusCode SetConfig(const std::map<std::string, std::string> &config,
+                                                  ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Resets performance measures of the request, following calls of GetPerformanceCounts
+     * report only inferences started after the reset
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success
+     */
+    virtual StatusCode ResetPerformanceCounts(ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,59 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the MemoryInfo struct
+ * @file ie_memory_info.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <map>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Host memory footprint of an executable network. All sizes are in bytes.
+ *
+ * The memory taken by a loaded network with N infer requests is
+ * total + N * requestIO, so it can be estimated right after LoadNetwork.
+ */
+struct MemoryInfo {
+    /**
+     * @brief Memory of one layer of the executable network
+     */
+    struct LayerMemoryInfo {
+        /** Prepared weights and other internal blobs of the layer */
+        size_t weights = 0;
+        /** Output tensors of the layer as if every tensor had its own buffer */
+        size_t outputs = 0;
+    };
+
+    /** Activation workspace of one graph copy after reuse of memory between tensors */
+    size_t workspace = 0;
+    /** Sum of all tensors of one graph copy without reuse, the workspace is compared to it */
+    size_t activationsNoReuse = 0;
+    /** Lower bound of the workspace: the maximal size of tensors alive at the same time */
+    size_t workspaceLowerBound = 0;
+    /** Constant tensors computed at load time, a part of the workspace */
+    size_t constants = 0;
+    /** Prepared weights, copies shared by several graph copies are counted once */
+    size_t weights = 0;
+    /** Input and output blobs allocated by one infer request */
+    size_t requestIO = 0;
+    /** Memory reserved by allocators above the requested sizes: alignment and page rounding */
+    size_t allocatorOverhead = 0;
+    /** Number of graph copies, e.g. CPU throughput streams. Each copy has its own workspace */
+    size_t graphCopies = 0;
+    /** workspace * graphCopies + weights + allocatorOverhead */
+    size_t total = 0;
+
+    /** Breakdown of one graph copy by layer names */
+    std::map<std::string, LayerMemoryInfo> layers;
+};
+
+}  // namespace InferenceEngine
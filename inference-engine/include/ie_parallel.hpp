@@ -0,0 +1,283 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Contains declarations and definitions for sequential and multi-threading implementations.
+ * Multi-threading support is implemented in two variants: using the Threading Building Blocks library and OpenMP*
+ * product, plus a thread pool built into the Inference Engine library. The threading backend is selected
+ * at build time by the IE_THREAD macro: IE_THREAD_OMP (default), IE_THREAD_TBB, IE_THREAD_POOL or IE_THREAD_SEQ.
+ * @file ie_parallel.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "ie_api.h"
+
+#define IE_THREAD_OMP 0
+#define IE_THREAD_TBB 1
+#define IE_THREAD_POOL 2
+#define IE_THREAD_SEQ 3
+
+#ifndef IE_THREAD
+#if defined(_OPENMP)
+#define IE_THREAD IE_THREAD_OMP
+#else
+#define IE_THREAD IE_THREAD_SEQ
+#endif
+#endif
+
+#if IE_THREAD == IE_THREAD_TBB
+#include "tbb/task_arena.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+#include "tbb/blocked_range.h"
+
+inline int parallel_get_max_threads() { return tbb::this_task_arena::max_concurrency(); }
+inline int parallel_get_num_threads() { return parallel_get_max_threads(); }
+inline int parallel_get_thread_num() {
+    auto thread_num = tbb::this_task_arena::current_thread_index();
+    return thread_num == tbb::task_arena::not_initialized ? 0 : thread_num;
+}
+inline void parallel_set_num_threads(int n) { return; }
+
+#elif IE_THREAD == IE_THREAD_OMP
+#include <omp.h>
+inline int parallel_get_max_threads() { return omp_get_max_threads(); }
+inline int parallel_get_num_threads() { return omp_get_num_threads(); }
+inline int parallel_get_thread_num() { return omp_get_thread_num(); }
+inline void parallel_set_num_threads(int n) { omp_set_num_threads(n); }
+
+#elif IE_THREAD == IE_THREAD_POOL
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Runs func(ithr, nthr) for ithr in [0, nthr) on the process wide thread pool.
+ * The pool is shared by all callers, the calling thread takes part in the execution of its own job,
+ * so concurrent and nested calls never wait for idle threads. Exceptions are rethrown in the caller
+ */
+INFERENCE_ENGINE_API_CPP(void) parallelPoolRun(int nthr, const std::function<void(int, int)> &func);
+
+/** @brief Number of threads of the pool including the calling one, limited by parallelPoolSetMaxThreads() */
+INFERENCE_ENGINE_API_CPP(int) parallelPoolMaxThreads();
+
+/** @brief Limits the number of threads used by the jobs started from the calling thread, 0 - no limit */
+INFERENCE_ENGINE_API_CPP(void) parallelPoolSetMaxThreads(int nthr);
+
+/** @brief Index of the pool job slot executed by the calling thread, 0 outside of parallel regions */
+INFERENCE_ENGINE_API_CPP(int) parallelPoolThreadNum();
+
+/** @brief Number of slots of the job executed by the calling thread, 1 outside of parallel regions */
+INFERENCE_ENGINE_API_CPP(int) parallelPoolNumThreads();
+
+}  // namespace details
+}  // namespace InferenceEngine
+
+inline int parallel_get_max_threads() { return InferenceEngine::details::parallelPoolMaxThreads(); }
+inline int parallel_get_num_threads() { return InferenceEngine::details::parallelPoolNumThreads(); }
+inline int parallel_get_thread_num() { return InferenceEngine::details::parallelPoolThreadNum(); }
+inline void parallel_set_num_threads(int n) { InferenceEngine::details::parallelPoolSetMaxThreads(n); }
+
+#elif IE_THREAD == IE_THREAD_SEQ
+inline int parallel_get_max_threads() { return 1; }
+inline int parallel_get_num_threads() { return 1; }
+inline int parallel_get_thread_num() { return 0; }
+inline void parallel_set_num_threads(int n) { return; }
+#endif
+
+
+namespace InferenceEngine {
+
+/**
+ * @brief Runs func(ithr, nthr) on nthr threads, nthr == 0 means all available threads
+ */
+template <typename F>
+void parallel_nt(int nthr, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+
+    tbb::parallel_for(0, nthr, [&](int ithr) {
+        func(ithr, nthr);
+    }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+
+    #pragma omp parallel num_threads(nthr)
+    func(parallel_get_thread_num(), parallel_get_num_threads());
+#elif IE_THREAD == IE_THREAD_POOL
+    if (nthr == 0) nthr = parallel_get_max_threads();
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+
+    details::parallelPoolRun(nthr, func);
+#elif IE_THREAD == IE_THREAD_SEQ
+    func(0, 1);
+#endif
+}
+
+/**
+ * @brief Splits n items between team threads, the first n % team threads get one item more
+ */
+template <typename T, typename Q>
+inline void splitter(const T &n, const Q &team, const Q &tid, T &n_start, T &n_end) {
+    if (team <= 1 || n == 0) {
+        n_start = 0;
+        n_end = n;
+    } else {
+        T n1 = (n + (T)team - 1) / (T)team;
+        T n2 = n1 - 1;
+        T T1 = n - n2 * (T)team;
+        n_end = (T)tid < T1 ? n1 : n2;
+        n_start = (T)tid <= T1 ? tid * n1 : T1 * n1 + ((T)tid - T1) * n2;
+    }
+
+    n_end += n_start;
+}
+
+template <typename T0, typename F>
+void for_1d(const int &ithr, const int &nthr, const T0 &D0, const F &func) {
+    T0 d0 {0}, end {0};
+    splitter(D0, nthr, ithr, d0, end);
+    for (; d0 < end; ++d0) func(d0);
+}
+
+template <typename T0, typename F>
+void parallel_for(const T0 &D0, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    const int nthr = parallel_get_max_threads();
+    tbb::parallel_for(0, nthr, [&](int ithr) {
+        for_1d(ithr, nthr, D0, func);
+    }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP || IE_THREAD == IE_THREAD_POOL
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_1d(ithr, nthr, D0, func);
+    });
+#elif IE_THREAD == IE_THREAD_SEQ
+    for_1d(0, 1, D0, func);
+#endif
+}
+
+template <typename T0, typename T1, typename F>
+void for_2d(const int &ithr, const int &nthr, const T0 &D0, const T1 &D1, const F &func) {
+    const size_t work_amount = (size_t)D0 * D1;
+    if (work_amount == 0) return;
+    size_t start {0}, end {0};
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0 {0}; T1 d1 {0};
+    d1 = static_cast<T1>(start % D1);
+    d0 = static_cast<T0>(start / D1 % D0);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1);
+        if (++d1 == D1) {
+            d1 = 0;
+            if (++d0 == D0) d0 = 0;
+        }
+    }
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_for2d(const T0 &D0, const T1 &D1, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    const int nthr = parallel_get_max_threads();
+    tbb::parallel_for(0, nthr, [&](int ithr) {
+        for_2d(ithr, nthr, D0, D1, func);
+    }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP || IE_THREAD == IE_THREAD_POOL
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_2d(ithr, nthr, D0, D1, func);
+    });
+#elif IE_THREAD == IE_THREAD_SEQ
+    for_2d(0, 1, D0, D1, func);
+#endif
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void for_3d(const int &ithr, const int &nthr, const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+    const size_t work_amount = (size_t)D0 * D1 * D2;
+    if (work_amount == 0) return;
+    size_t start {0}, end {0};
+    splitter(work_amount, nthr, ithr, start, end);
+
+    T0 d0 {0}; T1 d1 {0}; T2 d2 {0};
+    d2 = static_cast<T2>(start % D2);
+    d1 = static_cast<T1>(start / D2 % D1);
+    d0 = static_cast<T0>(start / D2 / D1 % D0);
+    for (size_t iwork = start; iwork < end; ++iwork) {
+        func(d0, d1, d2);
+        if (++d2 == D2) {
+            d2 = 0;
+            if (++d1 == D1) {
+                d1 = 0;
+                if (++d0 == D0) d0 = 0;
+            }
+        }
+    }
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_for3d(const T0 &D0, const T1 &D1, const T2 &D2, const F &func) {
+#if IE_THREAD == IE_THREAD_TBB
+    const int nthr = parallel_get_max_threads();
+    tbb::parallel_for(0, nthr, [&](int ithr) {
+        for_3d(ithr, nthr, D0, D1, D2, func);
+    }, tbb::static_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP || IE_THREAD == IE_THREAD_POOL
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for_3d(ithr, nthr, D0, D1, D2, func);
+    });
+#elif IE_THREAD == IE_THREAD_SEQ
+    for_3d(0, 1, D0, D1, D2, func);
+#endif
+}
+
+/**
+ * @brief Returns input + sum of func(d0) over [0, D0). The range is split into the same parts for any team size
+ * and partial sums are added in the order of parts, so the result doesn't depend on the scheduling
+ */
+template <typename T0, typename R, typename F>
+R parallel_sum(const T0 &D0, const R &input, const F &func) {
+#if IE_THREAD == IE_THREAD_SEQ
+    R sum = input;
+    for (T0 d0 = 0; d0 < D0; ++d0) sum += func(d0);
+    return sum;
+#else
+    const int nparts = parallel_get_max_threads() > 0 ? parallel_get_max_threads() : 1;
+    std::vector<R> partial(nparts, R(0));
+    parallel_nt(nparts, [&](const int ithr, const int nthr) {
+        // The team may be smaller than requested, then a thread takes several parts
+        for (int part = ithr; part < nparts; part += nthr) {
+            R sum = R(0);
+            for_1d(part, nparts, D0, [&](T0 d0) { sum += func(d0); });
+            partial[part] = sum;
+        }
+    });
+
+    R sum = input;
+    for (auto &p : partial) sum += p;
+    return sum;
+#endif
+}
+
+template <typename T0, typename T1, typename R, typename F>
+R parallel_sum2d(const T0 &D0, const T1 &D1, const R &input, const F &func) {
+    return parallel_sum((size_t)D0 * D1, input, [&](size_t i) {
+        return func(static_cast<T0>(i / D1), static_cast<T1>(i % D1));
+    });
+}
+
+}  // namespace InferenceEngine
@@ -45,6 +45,127 @@ DECLARE_CONFIG_VALUE(NO);
 */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 
+/**
+* @brief The key defines the number of threads used by the CPU plugin to execute one infer request of a network.
+* It is applied to the execution threads of the loaded network only.
+* This option should be used with a non-negative integer value, "0" (default) means all available cores
+*/
+DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
+
+/**
+* @brief The key restricts the execution threads of a loaded network to the listed CPUs.
+* i-th thread is pinned to the i-th CPU of the list. The list is given in the format used by
+* taskset and sysfs, e.g. "0-3,8,10-11". An empty value (default) does not restrict the threads
+*/
+DECLARE_CONFIG_KEY(CPU_AFFINITY);
+
+/**
+* @brief The key controls huge pages usage for the large CPU plugin allocations
+* (activation workspace, prepared weights and input/output blobs of infer requests).
+* This option should be used with values:
+* PluginConfigParams::NO (default) - regular pages only
+* PluginConfigParams::YES - transparent huge pages are requested via madvise()
+* PluginConfigParams::CPU_HUGE_PAGES_EXPLICIT - pages are taken from the hugetlbfs pool, with fallback to YES
+*/
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_EXPLICIT);
+
+/**
+* @brief The key defines NUMA placement of the CPU plugin allocations.
+* This option should be used with values:
+* PluginConfigParams::NO (default) - pages are placed by the first touch
+* PluginConfigParams::CPU_NUMA_LOCAL - pages are bound to the node of the thread which loads the network
+* or a non-negative node id, e.g. "1"
+*/
+DECLARE_CONFIG_KEY(CPU_NUMA_NODE);
+
+DECLARE_CONFIG_VALUE(CPU_NUMA_LOCAL);
+
+/**
+* @brief The key defines the number of CPU execution streams of a loaded network.
+* Each stream is a separate copy of the graph with its own thread team and workspace,
+* infer requests are distributed between streams in round-robin order.
+* This option should be used with a positive integer value, "1" by default.
+*/
+DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
+
+/**
+* @brief The key enables NUMA aware placement of the CPU execution streams.
+* Streams are spread over NUMA nodes, threads of a stream are pinned to the cores of its node
+* and its memory is allocated on the same node.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_NUMA_STREAMS);
+
+/**
+* @brief The key defines how many copies of the prepared weights are kept by the CPU execution streams.
+* This option should be used with values:
+* PluginConfigParams::CPU_WEIGHTS_PER_NODE (default) - one copy per NUMA node used by the streams,
+* more memory, but all weights are read from the local node
+* PluginConfigParams::CPU_WEIGHTS_SINGLE - one copy shared by all streams
+*/
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_REPLICAS);
+
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_PER_NODE);
+DECLARE_CONFIG_VALUE(CPU_WEIGHTS_SINGLE);
+
+/**
+* @brief The key makes the CPU plugin release weights of the network after it is loaded.
+* The plugin keeps its own copies of the weights it needs and drops the weights of the network layers,
+* so the IR .bin buffer is freed as soon as the application releases it too (see ICNNNetReader::ReleaseWeights).
+* The network can't be loaded again after that.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_RELEASE_WEIGHTS);
+
+/**
+* @brief The key joins the network to a named CPU workspace group.
+* Networks of a group share the memory for intermediate data, which is sized to the biggest of them.
+* Stream N of a network shares the memory with stream N of other networks of the group, so they must be
+* executed one after another: concurrent execution is detected and reported as an error.
+* Data of inputs, outputs and constant layers is not shared.
+* This option should be used with a name of the group, empty by default (no group).
+*/
+DECLARE_CONFIG_KEY(CPU_WORKSPACE_GROUP);
+
+/**
+* @brief The key makes the CPU plugin tune request completion for latency instead of CPU usage.
+* Wait spins for a short time before it blocks, completion callbacks are run by the thread which has executed
+* the request instead of a separate callback thread, and requests of different streams aren't serialized.
+* A slow callback delays the next requests of its stream in this mode.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_LOW_LATENCY);
+
+/**
+* @brief The key sets the priority class of an infer request, it is passed to IInferRequest::SetConfig.
+* Queued requests of a higher priority are started first. A request waiting in a queue is promoted to the next class
+* every 100 milliseconds, so requests of a low priority are not starved.
+* This option should be used with values: PluginConfigParams::REQUEST_PRIORITY_LOW,
+* PluginConfigParams::REQUEST_PRIORITY_NORMAL (default) or PluginConfigParams::REQUEST_PRIORITY_HIGH
+*/
+DECLARE_CONFIG_KEY(REQUEST_PRIORITY);
+
+DECLARE_CONFIG_VALUE(REQUEST_PRIORITY_LOW);
+DECLARE_CONFIG_VALUE(REQUEST_PRIORITY_NORMAL);
+DECLARE_CONFIG_VALUE(REQUEST_PRIORITY_HIGH);
+
+/**
+* @brief The key sets the deadline of an infer request in microseconds since StartAsync, it is passed to
+* IInferRequest::SetConfig. Queued requests of the same priority class are started in order of their deadlines.
+* This option should be used with an integer value, 0 (default) means no deadline
+*/
+DECLARE_CONFIG_KEY(REQUEST_DEADLINE);
+
+/**
+* @brief The key enables folding of constants when a network is loaded: BatchNormalization, ScaleShift and Power
+* layers which follow a Convolution or FullyConnected layer are merged into its weights and biases, and layers whose
+* inputs are all constant are computed once and replaced with Const layers. Only FP32 layers are folded.
+* This option should be used with values: PluginConfigParams::YES (default) or PluginConfigParams::NO
+*/
+DECLARE_CONFIG_KEY(FOLD_CONSTANTS);
+
 /**
 * @brief The name for setting performance counters option.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -0,0 +1,55 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the runtime tracer of the inference engine.
+ * The tracer records profiling scopes of the library and plugins (preprocessing, layers, executor queues,
+ * callbacks) to per thread ring buffers and dumps them in the Chrome trace event format, which can be
+ * opened with chrome://tracing or Perfetto.
+ * Tracing is disabled by default. Setting the IE_TRACE_FILE environment variable enables it at load time
+ * and dumps the trace to the given file at exit.
+ * @file ie_tracing.hpp
+ */
+#pragma once
+
+#include <ostream>
+#include <string>
+#include "ie_api.h"
+
+namespace InferenceEngine {
+namespace Tracing {
+
+/**
+ * @brief Enables or disables recording of trace events. Recorded events are kept when tracing is disabled.
+ * @param enable true to start recording, false to stop
+ */
+INFERENCE_ENGINE_API_CPP(void) Enable(bool enable);
+
+/**
+ * @brief Checks whether trace events are being recorded
+ * @return true if tracing is enabled
+ */
+INFERENCE_ENGINE_API_CPP(bool) IsEnabled();
+
+/**
+ * @brief Writes the recorded events in the Chrome trace event JSON format.
+ * Only the last events of each thread are kept, older ones are overwritten by the ring buffers.
+ * @param out Stream to write to
+ */
+INFERENCE_ENGINE_API_CPP(void) Dump(std::ostream &out);
+
+/**
+ * @brief Writes the recorded events in the Chrome trace event JSON format to a file
+ * @param fileName Name of the file to create
+ */
+INFERENCE_ENGINE_API_CPP(void) Dump(const std::string &fileName);
+
+/**
+ * @brief Drops all the recorded events
+ */
+INFERENCE_ENGINE_API_CPP(void) Clear();
+
+}  // namespace Tracing
+}  // namespace InferenceEngine
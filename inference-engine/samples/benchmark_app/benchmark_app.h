@@ -0,0 +1,173 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+#ifdef _WIN32
+#include <os/windows/w_dirent.h>
+#else
+#include <dirent.h>
+#endif
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for images argument
+static const char image_message[] = "Optional. Path to a folder with images or path to an image files. "\
+                                    "Inputs are filled with random values if it is not set.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Path to a plugin folder.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Specify the target device to infer on; CPU, GPU, FPGA or MYRIAD is acceptable. " \
+                                            "Sample will look for a suitable plugin for device specified (CPU by default)";
+
+/// @brief message for performance counters
+static const char performance_counter_message[] = "Enables per-layer performance report";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Number of iterations. If neither -niter nor -t is set, the benchmark runs for 60 seconds";
+
+/// @brief message for execution time
+static const char execution_time_message[] = "Duration of the measurement in seconds";
+
+/// @brief message for number of infer requests
+static const char ninfer_request_message[] = "Number of infer requests in flight (default is the number of streams)";
+
+/// @brief message for number of streams
+static const char nstreams_message[] = "Number of CPU execution streams (default 1)";
+
+/// @brief message for number of threads
+static const char nthreads_message[] = "Number of threads per CPU execution stream (default 0 - all available cores)";
+
+/// @brief message for thread pinning
+static const char pin_message[] = "Pin CPU threads to cores: YES (default) or NO";
+
+/// @brief message for batch size
+static const char batch_size_message[] = "Batch size (default is the batch of the model)";
+
+/// @brief message for the number of warm-up iterations
+static const char warmup_message[] = "Number of warm-up inferences of each request, not included into the results (default 1)";
+
+/// @brief message for the report file
+static const char report_message[] = "Path to a JSON file to store the results";
+
+/// @brief message for the trace file
+static const char trace_message[] = "Path to a file to store the Chrome trace of the measured inferences";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for clDNN (GPU)-targeted custom kernels."\
+                                            "Absolute path to the xml file with the kernels desc.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for MKLDNN (CPU)-targeted custom layers." \
+                                                 "Absolute path to a shared library with the kernels impl.";
+
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for set image file <br>
+DEFINE_string(i, "", image_message);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief device the target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Enable per-layer performance report
+DEFINE_bool(pc, false, performance_counter_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+/// Default is ./lib
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+/// It is a optional parameter
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/// @brief Iterations count (default 0 - limited by time)
+DEFINE_int32(niter, 0, iterations_count_message);
+
+/// @brief Measurement duration in seconds (default 0 - limited by iterations)
+DEFINE_int32(t, 0, execution_time_message);
+
+/// @brief Number of infer requests
+DEFINE_int32(nireq, 0, ninfer_request_message);
+
+/// @brief Number of CPU streams
+DEFINE_int32(nstreams, 1, nstreams_message);
+
+/// @brief Number of threads per CPU stream
+DEFINE_int32(nthreads, 0, nthreads_message);
+
+/// @brief Thread pinning
+DEFINE_string(pin, "YES", pin_message);
+
+/// @brief Batch size
+DEFINE_int32(b, 0, batch_size_message);
+
+/// @brief Warm-up iterations
+DEFINE_int32(nwarmup, 1, warmup_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(report, "", report_message);
+
+/// @brief Path to the Chrome trace
+DEFINE_string(trace, "", trace_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "    -i \"<path>\"             " << image_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"    " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
+    std::cout << "    -pp \"<path>\"            " << plugin_path_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -niter \"<integer>\"      " << iterations_count_message << std::endl;
+    std::cout << "    -t \"<integer>\"          " << execution_time_message << std::endl;
+    std::cout << "    -nwarmup \"<integer>\"    " << warmup_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << ninfer_request_message << std::endl;
+    std::cout << "    -b \"<integer>\"          " << batch_size_message << std::endl;
+    std::cout << "    -nstreams \"<integer>\"   " << nstreams_message << std::endl;
+    std::cout << "    -nthreads \"<integer>\"   " << nthreads_message << std::endl;
+    std::cout << "    -pin \"YES\"/\"NO\"         " << pin_message << std::endl;
+    std::cout << "    -pc                     " << performance_counter_message << std::endl;
+    std::cout << "    -report \"<path>\"        " << report_message << std::endl;
+    std::cout << "    -trace \"<path>\"         " << trace_message << std::endl;
+}
@@ -0,0 +1,457 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/**
+* @brief The entry point the Inference Engine benchmark application
+* @file benchmark_app/main.cpp
+* @example benchmark_app/main.cpp
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ie_tracing.hpp>
+
+#include <format_reader/format_reader_ptr.h>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <samples/args_helper.hpp>
+
+#include <ext_list.hpp>
+
+#include "benchmark_app.h"
+
+using namespace InferenceEngine;
+
+typedef std::chrono::high_resolution_clock Time;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+static const int defaultDurationSeconds = 60;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+
+    if (FLAGS_niter < 0 || FLAGS_t < 0) {
+        throw std::logic_error("Parameters -niter and -t must be positive");
+    }
+
+    if (FLAGS_nireq < 0) {
+        throw std::logic_error("Parameter -nireq must be positive");
+    }
+
+    if (FLAGS_nstreams < 1) {
+        throw std::logic_error("Parameter -nstreams must be more than 0 ! (default 1)");
+    }
+
+    if (FLAGS_nthreads < 0) {
+        throw std::logic_error("Parameter -nthreads must be positive");
+    }
+
+    if (FLAGS_pin != "YES" && FLAGS_pin != "NO") {
+        throw std::logic_error("Parameter -pin must be YES or NO");
+    }
+
+    if (FLAGS_b < 0 || FLAGS_nwarmup < 0) {
+        throw std::logic_error("Parameters -b and -nwarmup must be positive");
+    }
+
+    return true;
+}
+
+/**
+* @brief Fills a blob with uniformly distributed values, the values are reproducible between runs
+*/
+template<typename T>
+void fillBlobRandom(Blob::Ptr &blob, std::mt19937 &generator) {
+    std::uniform_real_distribution<float> distribution(0.f, 255.f);
+    auto data = blob->buffer().as<T *>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = static_cast<T>(distribution(generator));
+    }
+}
+
+void fillBlobRandom(Blob::Ptr &blob, std::mt19937 &generator) {
+    switch (blob->precision()) {
+        case Precision::FP32: fillBlobRandom<float>(blob, generator); break;
+        case Precision::U8: fillBlobRandom<uint8_t>(blob, generator); break;
+        case Precision::I8: fillBlobRandom<int8_t>(blob, generator); break;
+        case Precision::U16: fillBlobRandom<uint16_t>(blob, generator); break;
+        case Precision::I16: fillBlobRandom<int16_t>(blob, generator); break;
+        case Precision::I32: fillBlobRandom<int32_t>(blob, generator); break;
+        default:
+            throw std::logic_error(std::string("Input precision is not supported: ") + blob->precision().name());
+    }
+}
+
+/**
+* @brief Fills an U8 NCHW blob with images, images are repeated if the batch is larger than their number
+*/
+void fillBlobImages(Blob::Ptr &blob, const std::vector<std::shared_ptr<unsigned char>> &images) {
+    auto dims = blob->getTensorDesc().getDims();
+    size_t batch = dims[0];
+    size_t num_channels = dims[1];
+    size_t image_size = dims[3] * dims[2];
+    auto data = blob->buffer().as<uint8_t *>();
+
+    for (size_t image_id = 0; image_id < batch; ++image_id) {
+        const unsigned char *image = images[image_id % images.size()].get();
+        for (size_t pid = 0; pid < image_size; pid++) {
+            for (size_t ch = 0; ch < num_channels; ++ch) {
+                data[image_id * image_size * num_channels + ch * image_size + pid] = image[pid * num_channels + ch];
+            }
+        }
+    }
+}
+
+/**
+* @brief Returns p-th percentile of the sorted samples (nearest rank)
+*/
+double percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100 * sorted.size()));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+std::string jsonEscape(const std::string &str) {
+    std::string result;
+    for (char c : str) {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // ------------------------------ Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        /** This vector stores paths to the processed images **/
+        std::vector<std::string> imageNames;
+        if (!FLAGS_i.empty()) {
+            parseImagesArguments(imageNames);
+            if (imageNames.empty()) throw std::logic_error("No suitable images were found");
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 1. Load Plugin for inference engine -------------------------------------
+        slog::info << "Loading plugin" << slog::endl;
+        InferencePlugin plugin = PluginDispatcher({ FLAGS_pp, "../../../lib/intel64" , "" }).getPluginByDevice(FLAGS_d);
+
+        bool isCpu = FLAGS_d.find("CPU") != std::string::npos;
+        /** Loading default extensions **/
+        if (isCpu) {
+            plugin.AddExtension(std::make_shared<Extensions::Cpu::CpuExtensions>());
+        }
+
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            plugin.AddExtension(extension_ptr);
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            plugin.SetConfig({{PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c}});
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+
+        /** Printing plugin version **/
+        printPluginVersion(plugin, std::cout);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
+        slog::info << "Loading network files" << slog::endl;
+
+        CNNNetReader networkReader;
+        networkReader.ReadNetwork(FLAGS_m);
+        networkReader.ReadWeights(fileNameNoExt(FLAGS_m) + ".bin");
+        CNNNetwork network = networkReader.getNetwork();
+
+        if (FLAGS_b > 0) {
+            network.setBatchSize(FLAGS_b);
+        }
+        size_t batchSize = network.getBatchSize();
+        slog::info << "Batch size is " << batchSize << slog::endl;
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Configure input ------------------------------------------------------
+        InputsDataMap inputInfo(network.getInputsInfo());
+
+        std::vector<std::shared_ptr<unsigned char>> imagesData;
+        std::string imageInputName;
+        if (!imageNames.empty()) {
+            for (auto &item : inputInfo) {
+                auto dims = item.second->getTensorDesc().getDims();
+                if (dims.size() == 4 && dims[1] == 3) {
+                    imageInputName = item.first;
+                    /** Images are fed as U8, conversion is done by the plugin **/
+                    item.second->setPrecision(Precision::U8);
+                    item.second->setLayout(Layout::NCHW);
+                    break;
+                }
+            }
+            if (imageInputName.empty()) throw std::logic_error("The network has no image input for -i");
+
+            auto dims = inputInfo[imageInputName]->getTensorDesc().getDims();
+            for (auto &i : imageNames) {
+                FormatReader::ReaderPtr reader(i.c_str());
+                if (reader.get() == nullptr) {
+                    slog::warn << "Image " + i + " cannot be read!" << slog::endl;
+                    continue;
+                }
+                std::shared_ptr<unsigned char> data(reader->getData(dims[3], dims[2]));
+                if (data.get() != nullptr) {
+                    imagesData.push_back(data);
+                }
+            }
+            if (imagesData.empty()) throw std::logic_error("Valid input images were not found!");
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Loading model to the plugin ------------------------------------------
+        slog::info << "Loading model to the plugin" << slog::endl;
+
+        std::map<std::string, std::string> config;
+        if (FLAGS_pc) {
+            config[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        }
+        if (isCpu) {
+            config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(FLAGS_nstreams);
+            config[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(FLAGS_nthreads);
+            config[PluginConfigParams::KEY_CPU_BIND_THREAD] = FLAGS_pin;
+        } else if (FLAGS_nstreams != 1 || FLAGS_nthreads != 0) {
+            slog::warn << "-nstreams and -nthreads are applied to the CPU device only" << slog::endl;
+        }
+
+        auto loadStart = Time::now();
+        ExecutableNetwork executable_network = plugin.LoadNetwork(network, config);
+        slog::info << "Load time: " << std::chrono::duration_cast<ms>(Time::now() - loadStart).count() << " ms" << slog::endl;
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 5. Create infer requests and fill inputs --------------------------------
+        size_t nireq = FLAGS_nireq > 0 ? FLAGS_nireq : FLAGS_nstreams;
+        slog::info << "Creating " << nireq << " infer requests" << slog::endl;
+
+        std::mt19937 generator(0);
+        std::vector<InferRequest> inferRequests;
+        for (size_t i = 0; i < nireq; i++) {
+            InferRequest inferRequest = executable_network.CreateInferRequest();
+            for (auto &item : inputInfo) {
+                Blob::Ptr input = inferRequest.GetBlob(item.first);
+                if (item.first == imageInputName) {
+                    fillBlobImages(input, imagesData);
+                } else {
+                    fillBlobRandom(input, generator);
+                }
+            }
+            inferRequests.push_back(inferRequest);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 6. Warm up --------------------------------------------------------------
+        slog::info << "Warming up (" << FLAGS_nwarmup << " iterations per request)" << slog::endl;
+        for (int iter = 0; iter < FLAGS_nwarmup; iter++) {
+            for (auto &request : inferRequests) request.StartAsync();
+            for (auto &request : inferRequests) request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        }
+        if (FLAGS_pc) {
+            for (auto &request : inferRequests) request.ResetPerformanceCounts();
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 7. Measure --------------------------------------------------------------
+        int durationSeconds = FLAGS_t > 0 ? FLAGS_t : (FLAGS_niter > 0 ? 0 : defaultDurationSeconds);
+        if (FLAGS_niter > 0) {
+            slog::info << "Start inference (" << FLAGS_niter << " iterations)" << slog::endl;
+        }
+        if (durationSeconds > 0) {
+            slog::info << "Start inference (" << durationSeconds << " seconds)" << slog::endl;
+        }
+
+        /** Completed requests are returned to the idle queue by the callbacks and restarted by the main thread **/
+        std::mutex mutex;
+        std::condition_variable idleCondVar;
+        std::queue<size_t> idleRequests;
+        std::vector<Time::time_point> startTimes(nireq);
+        std::vector<double> latencies;
+        StatusCode failure = OK;
+
+        for (size_t i = 0; i < nireq; i++) {
+            inferRequests[i].SetCompletionCallback(std::function<void(InferRequest, StatusCode)>(
+                    [&, i](InferRequest, StatusCode code) {
+                auto finish = Time::now();
+                std::lock_guard<std::mutex> lock(mutex);
+                latencies.push_back(std::chrono::duration_cast<ms>(finish - startTimes[i]).count());
+                if (code != OK) failure = code;
+                idleRequests.push(i);
+                idleCondVar.notify_one();
+            }));
+            idleRequests.push(i);
+        }
+
+        if (!FLAGS_trace.empty()) {
+            Tracing::Clear();
+            Tracing::Enable(true);
+        }
+
+        size_t started = 0;
+        bool failed = false;
+        auto start = Time::now();
+        auto deadline = start + std::chrono::seconds(durationSeconds);
+        while (true) {
+            size_t id;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                idleCondVar.wait(lock, [&] { return !idleRequests.empty(); });
+                failed = failure != OK;
+                id = idleRequests.front();
+                idleRequests.pop();
+            }
+            bool iterationsDone = FLAGS_niter > 0 && started >= static_cast<size_t>(FLAGS_niter);
+            bool timeDone = durationSeconds > 0 && Time::now() >= deadline;
+            if (failed || iterationsDone || timeDone) {
+                break;
+            }
+            startTimes[id] = Time::now();
+            inferRequests[id].StartAsync();
+            started++;
+        }
+        /** Requests in flight are completed before the callbacks' state goes out of scope **/
+        for (auto &request : inferRequests) {
+            request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        }
+        if (failed) {
+            throw std::logic_error("Inference failed with status " + std::to_string(failure));
+        }
+        double totalMs = std::chrono::duration_cast<ms>(Time::now() - start).count();
+
+        if (!FLAGS_trace.empty()) {
+            Tracing::Enable(false);
+            Tracing::Dump(FLAGS_trace);
+            slog::info << "Trace is stored to " << FLAGS_trace << slog::endl;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 8. Report ---------------------------------------------------------------
+        std::vector<double> sorted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            sorted = latencies;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        double avgLatency = 0;
+        for (auto latency : sorted) avgLatency += latency;
+        avgLatency = sorted.empty() ? 0 : avgLatency / sorted.size();
+        double fps = totalMs > 0 ? 1000.0 * sorted.size() * batchSize / totalMs : 0;
+
+        std::cout << std::endl;
+        std::cout << "Iterations:    " << sorted.size() << std::endl;
+        std::cout << "Duration:      " << totalMs << " ms" << std::endl;
+        std::cout << "Latency:       avg " << avgLatency << " ms, min " << percentile(sorted, 0)
+                  << " ms, p50 " << percentile(sorted, 50) << " ms, p90 " << percentile(sorted, 90)
+                  << " ms, p99 " << percentile(sorted, 99) << " ms, max " << percentile(sorted, 100) << " ms" << std::endl;
+        std::cout << "Throughput:    " << fps << " FPS" << std::endl;
+        std::cout << std::endl;
+
+        std::map<std::string, InferenceEngineProfileInfo> performanceMap;
+        if (FLAGS_pc) {
+            /** Requests execute the same graph, the counters of the first one are representative **/
+            performanceMap = inferRequests[0].GetPerformanceCounts();
+            printPerformanceCounts(performanceMap, std::cout);
+        }
+
+        if (!FLAGS_report.empty()) {
+            std::ofstream report(FLAGS_report);
+            if (!report.good()) throw std::logic_error("Failed to create " + FLAGS_report);
+            report << "{" << std::endl;
+            report << "  \"model\": \"" << jsonEscape(FLAGS_m) << "\"," << std::endl;
+            report << "  \"device\": \"" << jsonEscape(FLAGS_d) << "\"," << std::endl;
+            report << "  \"batch\": " << batchSize << "," << std::endl;
+            report << "  \"nireq\": " << nireq << "," << std::endl;
+            report << "  \"nstreams\": " << FLAGS_nstreams << "," << std::endl;
+            report << "  \"nthreads\": " << FLAGS_nthreads << "," << std::endl;
+            report << "  \"iterations\": " << sorted.size() << "," << std::endl;
+            report << "  \"duration_ms\": " << totalMs << "," << std::endl;
+            report << "  \"throughput_fps\": " << fps << "," << std::endl;
+            report << "  \"latency_ms\": {\"avg\": " << avgLatency << ", \"min\": " << percentile(sorted, 0)
+                   << ", \"p50\": " << percentile(sorted, 50) << ", \"p90\": " << percentile(sorted, 90)
+                   << ", \"p99\": " << percentile(sorted, 99) << ", \"max\": " << percentile(sorted, 100) << "}";
+            if (FLAGS_pc) {
+                report << "," << std::endl << "  \"layers\": [";
+                bool first = true;
+                for (auto &it : performanceMap) {
+                    const auto &info = it.second;
+                    report << (first ? "" : ",") << std::endl;
+                    report << "    {\"name\": \"" << jsonEscape(it.first) << "\""
+                           << ", \"layer_type\": \"" << jsonEscape(info.layer_type) << "\""
+                           << ", \"exec_type\": \"" << jsonEscape(info.exec_type) << "\""
+                           << ", \"status\": " << info.status
+                           << ", \"real_time_us\": " << info.realTime_uSec
+                           << ", \"cpu_time_us\": " << info.cpu_uSec
+                           << ", \"count\": " << info.count
+                           << ", \"p50_us\": " << info.p50_uSec
+                           << ", \"p90_us\": " << info.p90_uSec
+                           << ", \"p99_us\": " << info.p99_uSec << "}";
+                    first = false;
+                }
+                report << std::endl << "  ]";
+            }
+            report << std::endl << "}" << std::endl;
+            slog::info << "Report is stored to " << FLAGS_report << slog::endl;
+        }
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
@@ -655,8 +655,14 @@ static UNUSED void printPerformanceCounts(const std::map<std::string, InferenceE
         stream << std::setw(30) << std::left << "layerType: " + std::string(it.second.layer_type) + " ";
         stream << std::setw(20) << std::left << "realTime: " + std::to_string(it.second.realTime_uSec);
         stream << std::setw(20) << std::left << " cpu: "  + std::to_string(it.second.cpu_uSec);
-        stream << " execType: " << it.second.exec_type << std::endl;
-        if (it.second.realTime_uSec > 0) {
+        stream << " execType: " << it.second.exec_type;
+        if (it.second.count > 1) {
+            stream << " p50/p90/p99: " << it.second.p50_uSec << "/" << it.second.p90_uSec << "/" << it.second.p99_uSec
+                   << " (" << it.second.count << " runs)";
+        }
+        stream << std::endl;
+        // Skip one-time stages like LoadNetwork which are reported as NOT_RUN
+        if (it.second.status == InferenceEngine::InferenceEngineProfileInfo::EXECUTED && it.second.realTime_uSec > 0) {
             totalTime += it.second.realTime_uSec;
         }
     }
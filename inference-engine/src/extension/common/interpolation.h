@@ -0,0 +1,194 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "ie_parallel.hpp"
+#include "defs.h"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Source coordinates and weights of the output coordinates along one axis: the output coordinate o takes
+// weight[o*taps + t] of the source coordinate index[o*taps + t] for each of the taps. Unused taps have zero weight.
+struct InterpolationTable {
+    int taps = 0;
+    std::vector<int> index;
+    std::vector<float> weight;
+
+    void resize(int outputs, int taps_count) {
+        taps = taps_count;
+        index.assign(static_cast<size_t>(outputs) * taps, 0);
+        weight.assign(static_cast<size_t>(outputs) * taps, 0.0f);
+    }
+};
+
+// Nearest source coordinate of the output coordinate o is round(o * scale + shift - 0.5)
+static inline void build_nearest_table(InterpolationTable &table, int I, int O, float scale, float shift) {
+    table.resize(O, 1);
+    for (int o = 0; o < O; o++) {
+        int i = static_cast<int>(std::round(o * scale + shift - 0.5f));
+        table.index[o] = std::min(std::max(i, 0), I - 1);
+        table.weight[o] = 1.0f;
+    }
+}
+
+// Linear interpolation where the first and the last coordinates of the input and of the output are aligned,
+// source coordinates are offset by 'offset'
+static inline void build_linear_table(InterpolationTable &table, int I, int O, int offset) {
+    const float scale = (O > 1) ? static_cast<float>(I - 1) / (O - 1) : 0.0f;
+    table.resize(O, 2);
+    for (int o = 0; o < O; o++) {
+        float f = scale * o;
+        int i0 = static_cast<int>(f);
+        int i1 = (i0 < I - 1) ? i0 + 1 : i0;
+        float lambda = f - i0;
+
+        table.index[2*o] = offset + i0;
+        table.index[2*o + 1] = offset + i1;
+        table.weight[2*o] = 1.0f - lambda;
+        table.weight[2*o + 1] = lambda;
+    }
+}
+
+// Triangle filter of width 2 / a around o * scale + shift - 0.5, within 'radius' source coordinates of the nearest one.
+// Weights are normalized, an output without any source coordinate in the filter gets zero weights.
+static inline void build_triangle_table(InterpolationTable &table, int I, int O, float scale, float shift,
+                                        float a, int radius) {
+    int taps = 1;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1)
+            table.resize(O, taps);
+        for (int o = 0; o < O; o++) {
+            float f = o * scale + shift - 0.5f;
+            int r = static_cast<int>(std::round(f));
+
+            int count = 0;
+            float sum = 0.0f;
+            for (int i = std::max(r - radius, 0); i <= std::min(r + radius, I - 1); i++) {
+                float w = a * std::max(0.0f, 1 - std::abs(a * (f - i)));
+                if (w == 0.0f)
+                    continue;
+                if (pass == 1) {
+                    table.index[o*taps + count] = i;
+                    table.weight[o*taps + count] = w;
+                }
+                sum += w;
+                count++;
+            }
+
+            if (pass == 0) {
+                taps = std::max(taps, count);
+            } else {
+                for (int t = 0; t < count; t++)
+                    table.weight[o*taps + t] /= sum;
+            }
+        }
+    }
+}
+
+// Interpolates blk channels of one output point from the rows and columns of the tables
+template <int blk>
+static inline void interpolate_point(const float *psrc, int IW,
+                                     const int *iy, const float *wy, int ty_taps,
+                                     const int *ix, const float *wx, int tx_taps,
+                                     float *pdst) {
+    float acc[blk] = {};
+    for (int ty = 0; ty < ty_taps; ty++) {
+        float row[blk] = {};
+        for (int tx = 0; tx < tx_taps; tx++) {
+            const float *p = psrc + (iy[ty] * IW + ix[tx]) * blk;
+            for (int c = 0; c < blk; c++)
+                row[c] += wx[tx] * p[c];
+        }
+        for (int c = 0; c < blk; c++)
+            acc[c] += wy[ty] * row[c];
+    }
+    for (int c = 0; c < blk; c++)
+        pdst[c] = acc[c];
+}
+
+#if defined(HAVE_AVX512F)
+template <>
+inline void interpolate_point<16>(const float *psrc, int IW,
+                                  const int *iy, const float *wy, int ty_taps,
+                                  const int *ix, const float *wx, int tx_taps,
+                                  float *pdst) {
+    __m512 vacc = _mm512_setzero_ps();
+    for (int ty = 0; ty < ty_taps; ty++) {
+        __m512 vrow = _mm512_setzero_ps();
+        for (int tx = 0; tx < tx_taps; tx++) {
+            const float *p = psrc + (iy[ty] * IW + ix[tx]) * 16;
+            vrow = _mm512_fmadd_ps(_mm512_set1_ps(wx[tx]), _mm512_loadu_ps(p), vrow);
+        }
+        vacc = _mm512_fmadd_ps(_mm512_set1_ps(wy[ty]), vrow, vacc);
+    }
+    _mm512_storeu_ps(pdst, vacc);
+}
+#endif
+
+#if defined(HAVE_AVX2)
+template <>
+inline void interpolate_point<8>(const float *psrc, int IW,
+                                 const int *iy, const float *wy, int ty_taps,
+                                 const int *ix, const float *wx, int tx_taps,
+                                 float *pdst) {
+    __m256 vacc = _mm256_setzero_ps();
+    for (int ty = 0; ty < ty_taps; ty++) {
+        __m256 vrow = _mm256_setzero_ps();
+        for (int tx = 0; tx < tx_taps; tx++) {
+            const float *p = psrc + (iy[ty] * IW + ix[tx]) * 8;
+            vrow = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(wx[tx]), _mm256_loadu_ps(p)), vrow);
+        }
+        vacc = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(wy[ty]), vrow), vacc);
+    }
+    _mm256_storeu_ps(pdst, vacc);
+}
+#endif
+
+// Separable interpolation of a [N, CB, IH, IW, blk] tensor into [N, CB, OH, OW, blk], planar data is blk == 1
+template <int blk>
+static void interpolate_blk(const float *src, float *dst, int N, int CB, int IH, int IW, int OH, int OW,
+                            const InterpolationTable &table_y, const InterpolationTable &table_x) {
+    InferenceEngine::parallel_for3d(N, CB, OH, [&](int n, int cb, int oy) {
+        const float *psrc = src + static_cast<size_t>(n * CB + cb) * IH * IW * blk;
+        float *pdst = dst + (static_cast<size_t>(n * CB + cb) * OH + oy) * OW * blk;
+
+        const int *iy = &table_y.index[oy * table_y.taps];
+        const float *wy = &table_y.weight[oy * table_y.taps];
+        for (int ox = 0; ox < OW; ox++) {
+            interpolate_point<blk>(psrc, IW, iy, wy, table_y.taps,
+                                   &table_x.index[ox * table_x.taps], &table_x.weight[ox * table_x.taps], table_x.taps,
+                                   pdst + ox * blk);
+        }
+    });
+}
+
+// Dispatches to the kernel of the block size of the layout, returns false for unsupported block sizes
+static inline bool interpolate(const float *src, float *dst, int N, int CB, int blk,
+                               int IH, int IW, int OH, int OW,
+                               const InterpolationTable &table_y, const InterpolationTable &table_x) {
+    switch (blk) {
+        case 1:
+            interpolate_blk<1>(src, dst, N, CB, IH, IW, OH, OW, table_y, table_x);
+            return true;
+        case 8:
+            interpolate_blk<8>(src, dst, N, CB, IH, IW, OH, OW, table_y, table_x);
+            return true;
+        case 16:
+            interpolate_blk<16>(src, dst, N, CB, IH, IW, OH, OW, table_y, table_x);
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
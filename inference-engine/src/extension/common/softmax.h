@@ -16,13 +16,12 @@
 #endif
 
 #include <cmath>
-#include <omp.h>
+#include "ie_parallel.hpp"
 #include "defs.h"
 
 static inline
 void softmax_many_batches(const float *src_data, float *dst_data, int B, int C, int H, int W) {
-    #pragma omp parallel for schedule(static)
-    for (int i = 0; i < B * H * W; i++) {
+    InferenceEngine::parallel_for(B * H * W, [&](int i) {
         const float *psrc = src_data + (i / (H * W)) * C * H * W - (i / (H * W)) * H * W;
         float *pdst = dst_data + (i / (H * W)) * C * H * W - (i / (H * W)) * H * W;
 
@@ -41,66 +40,113 @@ void softmax_many_batches(const float *src_data, float *dst_data, int B, int C,
         for (int c = 0; c < C; c++) {
             pdst[c * H * W + i] = pdst[c * H * W + i] / expSum;
         }
-    }
+    });
 }
 
-static inline
-void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H, int W) {
-    for (int b = 0; b < B; b++) {
 #if defined(HAVE_AVX2)
-        #pragma omp parallel for schedule(static)
-        for (int i = 0; i <= H*W - 8; i += 8) {
-            __m256 vmax = _mm256_loadu_ps(src_data + b*C*H*W + i);
-            for (int c = 0; c < C; c++) {
-                __m256 vval = _mm256_loadu_ps(src_data + b*C*H*W + c*H*W + i);
-                __m256 vmask = _mm256_cmp_ps(vval, vmax, _CMP_GT_OS);
-                vmax = _mm256_blendv_ps(vmax, vval, vmask);
-            }
-
-            __m256 vexpSum = _mm256_setzero_ps();
-            for (int c = 0; c < C; c++) {
-                __m256 vval = _mm256_loadu_ps(src_data + b*C*H*W + c*H*W + i);
+// Softmax over the C channels, 'stride' apart, of 8 consecutive positions
+static inline void softmax_avx_block(const float *psrc, float *pdst, int C, int stride) {
+    __m256 vmax = _mm256_loadu_ps(psrc);
+    for (int c = 0; c < C; c++) {
+        __m256 vval = _mm256_loadu_ps(psrc + c*stride);
+        __m256 vmask = _mm256_cmp_ps(vval, vmax, _CMP_GT_OS);
+        vmax = _mm256_blendv_ps(vmax, vval, vmask);
+    }
+
+    __m256 vexpSum = _mm256_setzero_ps();
+    for (int c = 0; c < C; c++) {
+        __m256 vval = _mm256_loadu_ps(psrc + c*stride);
 #if USE_FAST_EXP
-                __m256 vres = _avx_fast_exp_ps(_mm256_sub_ps(vval, vmax));
+        __m256 vres = _avx_fast_exp_ps(_mm256_sub_ps(vval, vmax));
 #else
-                __m256 vres = _avx_opt_exp_ps(_mm256_sub_ps(vval, vmax));
+        __m256 vres = _avx_opt_exp_ps(_mm256_sub_ps(vval, vmax));
 #endif
-                vexpSum = _mm256_add_ps(vexpSum, vres);
-                _mm256_storeu_ps(dst_data + b*C*H*W + c*H*W + i, vres);
-            }
-
-            for (int c = 0; c < C; c++) {
-                __m256 vval = _mm256_loadu_ps(dst_data + b*C*H*W + c*H*W + i);
-                _mm256_storeu_ps(dst_data + b*C*H*W + c*H*W + i, _mm256_div_ps(vval, vexpSum));
-            }
-        }
-#elif defined(HAVE_SSE)
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i <= H*W - 4; i += 4) {
-            __m128 vmax = _mm_loadu_ps(src_data + b*C*H*W + i);
-            for (int c = 0; c < C; c++) {
-                __m128 vval = _mm_loadu_ps(src_data + b*C*H*W + c*H*W + i);
-                __m128 vmask = _mm_cmpgt_ps(vval, vmax);
-                vmax = _mm_blendv_ps(vmax, vval, vmask);
-            }
-
-            __m128 vexpSum = _mm_setzero_ps();
-            for (int c = 0; c < C; c++) {
-                __m128 vval = _mm_loadu_ps(src_data + b*C*H*W + c*H*W + i);
+        vexpSum = _mm256_add_ps(vexpSum, vres);
+        _mm256_storeu_ps(pdst + c*stride, vres);
+    }
+
+    for (int c = 0; c < C; c++) {
+        __m256 vval = _mm256_loadu_ps(pdst + c*stride);
+        _mm256_storeu_ps(pdst + c*stride, _mm256_div_ps(vval, vexpSum));
+    }
+}
+#endif
+
+#if defined(HAVE_SSE)
+// Softmax over the C channels, 'stride' apart, of 4 consecutive positions
+static inline void softmax_sse_block(const float *psrc, float *pdst, int C, int stride) {
+    __m128 vmax = _mm_loadu_ps(psrc);
+    for (int c = 0; c < C; c++) {
+        __m128 vval = _mm_loadu_ps(psrc + c*stride);
+        __m128 vmask = _mm_cmpgt_ps(vval, vmax);
+        vmax = _mm_blendv_ps(vmax, vval, vmask);
+    }
+
+    __m128 vexpSum = _mm_setzero_ps();
+    for (int c = 0; c < C; c++) {
+        __m128 vval = _mm_loadu_ps(psrc + c*stride);
 #if USE_FAST_EXP
-                __m128 vres = _sse_fast_exp_ps(_mm_sub_ps(vval, vmax));
+        __m128 vres = _sse_fast_exp_ps(_mm_sub_ps(vval, vmax));
 #else
-                __m128 vres = _sse_opt_exp_ps(_mm_sub_ps(vval, vmax));
+        __m128 vres = _sse_opt_exp_ps(_mm_sub_ps(vval, vmax));
 #endif
-                vexpSum = _mm_add_ps(vexpSum, vres);
-                _mm_storeu_ps(dst_data + b*C*H*W + c*H*W + i, vres);
-            }
-
-            for (int c = 0; c < C; c++) {
-                __m128 vval = _mm_loadu_ps(dst_data + b*C*H*W + c*H*W + i);
-                _mm_storeu_ps(dst_data + b*C*H*W + c*H*W + i, _mm_div_ps(vval, vexpSum));
-            }
-        }
+        vexpSum = _mm_add_ps(vexpSum, vres);
+        _mm_storeu_ps(pdst + c*stride, vres);
+    }
+
+    for (int c = 0; c < C; c++) {
+        __m128 vval = _mm_loadu_ps(pdst + c*stride);
+        _mm_storeu_ps(pdst + c*stride, _mm_div_ps(vval, vexpSum));
+    }
+}
+#endif
+
+// Softmax over the C channels, 'stride' apart, of one position
+static inline void softmax_scalar(const float *psrc, float *pdst, int C, int stride) {
+    float max = psrc[0];
+    for (int c = 0; c < C; c++) {
+        float val = psrc[c * stride];
+        if (val > max) max = val;
+    }
+
+    float expSum = 0;
+    for (int c = 0; c < C; c++) {
+        pdst[c * stride] = exp(psrc[c * stride] - max);
+        expSum += pdst[c * stride];
+    }
+
+    for (int c = 0; c < C; c++) {
+        pdst[c * stride] = pdst[c * stride] / expSum;
+    }
+}
+
+// Softmax over the C channels, 'stride' apart, of 'count' consecutive positions in the calling thread
+static inline void softmax_positions(const float *psrc, float *pdst, int C, int stride, int count) {
+    int i = 0;
+#if defined(HAVE_AVX2)
+    for (; i + 8 <= count; i += 8)
+        softmax_avx_block(psrc + i, pdst + i, C, stride);
+#elif defined(HAVE_SSE)
+    for (; i + 4 <= count; i += 4)
+        softmax_sse_block(psrc + i, pdst + i, C, stride);
+#endif
+    for (; i < count; i++)
+        softmax_scalar(psrc + i, pdst + i, C, stride);
+}
+
+static inline
+void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H, int W) {
+    for (int b = 0; b < B; b++) {
+#if defined(HAVE_AVX2)
+        InferenceEngine::parallel_for(H*W / 8, [&](int ib) {
+            int i = ib * 8;
+            softmax_avx_block(src_data + b*C*H*W + i, dst_data + b*C*H*W + i, C, H*W);
+        });
+#elif defined(HAVE_SSE)
+        InferenceEngine::parallel_for(H*W / 4, [&](int ib) {
+            int i = ib * 4;
+            softmax_sse_block(src_data + b*C*H*W + i, dst_data + b*C*H*W + i, C, H*W);
+        });
 #endif
 
 #if defined(HAVE_AVX2)
@@ -111,21 +157,7 @@ void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H
         int start = 0;
 #endif
         for (int i = start; i < H * W; i++) {
-            float max = src_data[b * C * H * W + i];
-            for (int c = 0; c < C; c++) {
-                float val = src_data[b * C * H * W + c * H * W + i];
-                if (val > max) max = val;
-            }
-
-            float expSum = 0;
-            for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + i] = exp(src_data[b * C * H * W + c * H * W + i] - max);
-                expSum += dst_data[b * C * H * W + c * H * W + i];
-            }
-
-            for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + i] = dst_data[b * C * H * W + c * H * W + i] / expSum;
-            }
+            softmax_scalar(src_data + b*C*H*W + i, dst_data + b*C*H*W + i, C, H*W);
         }
     }
-}
\ No newline at end of file
+}
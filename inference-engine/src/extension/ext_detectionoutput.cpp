@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <cfloat>
 #include <vector>
@@ -17,12 +18,6 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-template <typename T>
-static bool SortScorePairDescend(const std::pair<float, T>& pair1,
-                                 const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
-}
-
 class DetectionOutputImpl: public ExtLayerBase {
 public:
     explicit DetectionOutputImpl(const CNNLayer* layer) {
@@ -101,9 +96,22 @@ public:
                     {Precision::FP32, decoded_bboxes_size, {decoded_bboxes_size, {0, 1, 2}}});
             _bbox_sizes->allocate();
 
-            InferenceEngine::SizeVector num_priors_actual_size{static_cast<size_t>(_num)};
-            _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, num_priors_actual_size, C});
-            _num_priors_actual->allocate();
+            InferenceEngine::SizeVector detections_offset_size{static_cast<size_t>(_num)};
+            _detections_offset = InferenceEngine::make_shared_blob<int>({Precision::UNSPECIFIED, detections_offset_size, C});
+            _detections_offset->allocate();
+
+            // Kept boxes of the class processed by a thread, as separate arrays of xmin, ymin, xmax, ymax and size
+            _max_threads = parallel_get_max_threads();
+            _max_kept = _top_k == -1 ? _num_priors : std::min(_top_k, _num_priors);
+            InferenceEngine::SizeVector kept_boxes_size{static_cast<size_t>(_max_threads),
+                                                        5,
+                                                        static_cast<size_t>(std::max(_max_kept, 1))};
+            _kept_boxes = InferenceEngine::make_shared_blob<float>(
+                    {Precision::FP32, kept_boxes_size, {kept_boxes_size, {0, 1, 2}}});
+            _kept_boxes->allocate();
+
+            if (_keep_top_k > 0)
+                _top_detections.resize(static_cast<size_t>(_num) * _keep_top_k);
 
             addConfig(layer, {DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN),
@@ -129,56 +137,60 @@ public:
         int *detections_data       = _detections_count->buffer();
         int *buffer_data           = _buffer->buffer();
         int *indices_data          = _indices->buffer();
-        int *num_priors_actual     = _num_priors_actual->buffer();
+        int *detections_offset     = _detections_offset->buffer();
+        float *kept_boxes_data     = _kept_boxes->buffer();
 
         const float *prior_variances = prior_data + _num_priors*_prior_size;
-        const float *ppriors = prior_data;
 
-        for (int n = 0; n < N; ++n) {
-            if (_share_location) {
-                const float *ploc = loc_data + n*4*_num_priors;
-                float *pboxes = decoded_bboxes_data + n*4*_num_priors;
-                float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-            } else {
-                for (int c = 0; c < _num_loc_classes; ++c) {
-                    if (c == _background_label_id) {
-                        continue;
-                    }
-
-                    const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                    float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
-                    float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+        // Priors are shared by all the images
+        int num_priors_actual = _num_priors;
+        if (!_normalized) {
+            for (int p = 0; p < _num_priors; ++p) {
+                if (prior_data[p * _prior_size + 0] == -1.f) {
+                    num_priors_actual = p;
+                    break;
                 }
             }
         }
 
-        for (int n = 0; n < N; ++n) {
+        parallel_for3d(N, _num_loc_classes, num_priors_actual, [&](int n, int c, int p) {
+            if (!_share_location && c == _background_label_id) {
+                return;
+            }
+
+            const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
+            const int offset = (n*_num_loc_classes + c)*_num_priors + p;
+            decodeBBox(prior_data + p*_prior_size, ploc + 4*p*_num_loc_classes, prior_variances + p*4,
+                       decoded_bboxes_data + offset*4, bbox_sizes_data[offset]);
+        });
+
+        // Blocks of priors are transposed, so reads and writes of a block stay in a few cache lines
+        const int prior_block = 16;
+        parallel_for2d(N, (_num_priors + prior_block - 1) / prior_block, [&](int n, int pb) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes;
+            const int p_end = std::min(_num_priors, (pb + 1)*prior_block);
             for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                for (int p = pb*prior_block; p < p_end; ++p) {
+                    preordered[c*_num_priors + p] = pconf[p*_num_classes + c];
                 }
             }
-        }
-
-        memset(detections_data, 0, N*_num_classes*sizeof(int));
+        });
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
+        // Classes of all the images are processed at once, interleaved between threads as
+        // the cost of a class depends on the number of its confident priors
+        parallel_nt(std::min(parallel_get_max_threads(), _max_threads), [&](const int ithr, const int nthr) {
+            float *pkept = kept_boxes_data + ithr*5*std::max(_max_kept, 1);
+            for (int nc = ithr; nc < N*_num_classes; nc += nthr) {
+                const int n = nc / _num_classes;
+                const int c = nc % _num_classes;
 
-#pragma omp parallel for schedule(static)
-            for (int c = 0; c < _num_classes; ++c) {
+                detections_data[nc] = 0;
                 if (c == _background_label_id) {
                     // Ignore background class.
                     continue;
                 }
 
-                int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                int *pbuffer     = buffer_data + c*_num_priors;
-                int *pdetections = detections_data + n*_num_classes + c;
-
-                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
                 const float *pboxes;
                 const float *psizes;
                 if (_share_location) {
@@ -189,42 +201,17 @@ public:
                     psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                 }
 
-                nms(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
-            }
-
-            for (int c = 0; c < _num_classes; ++c) {
-                detections_total += detections_data[n*_num_classes + c];
-            }
-
-            if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
-
-                for (int c = 0; c < _num_classes; ++c) {
-                    int detections = detections_data[n*_num_classes + c];
-                    int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-
-                    for (int i = 0; i < detections; ++i) {
-                        int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
-                    }
-                }
-
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
-
-                // Store the new indices.
-                memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
-
-                for (int j = 0; j < conf_index_class_map.size(); ++j) {
-                    int label = conf_index_class_map[j].second.first;
-                    int idx = conf_index_class_map[j].second.second;
-                    int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
-                    pindices[detections_data[n*_num_classes + label]] = idx;
-                    detections_data[n*_num_classes + label]++;
-                }
+                nms(reordered_conf_data + nc*_num_priors, pboxes, psizes, buffer_data + nc*_num_priors,
+                    indices_data + nc*_num_priors, pkept, detections_data[nc], num_priors_actual);
             }
+        });
+
+        if (_keep_top_k > -1) {
+            parallel_for(N, [&](int n) {
+                keepTopK(reordered_conf_data + n*_num_classes*_num_priors, indices_data + n*_num_classes*_num_priors,
+                         detections_data + n*_num_classes,
+                         _keep_top_k > 0 ? &_top_detections[static_cast<size_t>(n) * _keep_top_k] : nullptr);
+            });
         }
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
@@ -242,36 +229,34 @@ public:
 
         int count = 0;
         for (int n = 0; n < N; ++n) {
+            detections_offset[n] = count;
+            for (int c = 0; c < _num_classes; ++c) {
+                count += detections_data[n*_num_classes + c];
+            }
+        }
+
+        parallel_for(N, [&](int n) {
             const float *pconf   = reordered_conf_data + n * _num_priors * _num_classes;
             const float *pboxes  = decoded_bboxes_data + n*_num_priors*4*_num_loc_classes;
             const int *pindices  = indices_data + n*_num_classes*_num_priors;
+            float *pdst = dst_data + detections_offset[n] * DETECTION_SIZE;
 
             for (int c = 0; c < _num_classes; ++c) {
                 for (int i = 0; i < detections_data[n*_num_classes + c]; ++i) {
                     int idx = pindices[c*_num_priors + i];
-
-                    dst_data[count * DETECTION_SIZE + 0] = n;
-                    dst_data[count * DETECTION_SIZE + 1] = _decrease_label_id ? c-1 : c;
-                    dst_data[count * DETECTION_SIZE + 2] = pconf[c*_num_priors + idx];
-
-                    float xmin = _share_location ? pboxes[idx*4 + 0] :
-                                 pboxes[c*4*_num_priors + idx*4 + 0];
-                    float ymin = _share_location ? pboxes[idx*4 + 1] :
-                                 pboxes[c*4*_num_priors + idx*4 + 1];
-                    float xmax = _share_location ? pboxes[idx*4 + 2] :
-                                 pboxes[c*4*_num_priors + idx*4 + 2];
-                    float ymax = _share_location ? pboxes[idx*4 + 3] :
-                                 pboxes[c*4*_num_priors + idx*4 + 3];
-
-                    dst_data[count * DETECTION_SIZE + 3] = xmin;
-                    dst_data[count * DETECTION_SIZE + 4] = ymin;
-                    dst_data[count * DETECTION_SIZE + 5] = xmax;
-                    dst_data[count * DETECTION_SIZE + 6] = ymax;
-
-                    ++count;
+                    const float *pbox = _share_location ? pboxes + idx*4 : pboxes + c*4*_num_priors + idx*4;
+
+                    pdst[0] = n;
+                    pdst[1] = _decrease_label_id ? c-1 : c;
+                    pdst[2] = pconf[c*_num_priors + idx];
+                    pdst[3] = pbox[0];
+                    pdst[4] = pbox[1];
+                    pdst[5] = pbox[2];
+                    pdst[6] = pbox[3];
+                    pdst += DETECTION_SIZE;
                 }
             }
-        }
+        });
 
         if (count < N*_keep_top_k) {
             // marker at end of boxes list
@@ -316,11 +301,19 @@ private:
         CENTER_SIZE = 2,
     };
 
-    void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+    struct ScoredDetection {
+        float conf;
+        int label;
+        int idx;
+    };
+
+    void decodeBBox(const float *prior, const float *loc, const float *variance,
+                    float *decoded_bbox, float &decoded_bbox_size);
 
     void nms(const float *conf_data, const float *bboxes, const float *sizes,
-             int *buffer, int *indices, int &detections, int num_priors_actual);
+             int *buffer, int *indices, float *kept_boxes, int &detections, int num_priors_actual);
+
+    void keepTopK(const float *conf_data, int *indices, int *detections, ScoredDetection *top_detections);
 
     InferenceEngine::Blob::Ptr _decoded_bboxes;
     InferenceEngine::Blob::Ptr _buffer;
@@ -328,7 +321,11 @@ private:
     InferenceEngine::Blob::Ptr _detections_count;
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
-    InferenceEngine::Blob::Ptr _num_priors_actual;
+    InferenceEngine::Blob::Ptr _detections_offset;
+    InferenceEngine::Blob::Ptr _kept_boxes;
+    std::vector<ScoredDetection> _top_detections;
+    int _max_threads = 1;
+    int _max_kept = 0;
 };
 
 struct ConfidenceComparator {
@@ -343,142 +340,138 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
+// Checks whether the box overlaps any of the kept boxes more than the threshold,
+// the overlaps are computed as in Caffe: intersection over union of the box sizes
+static inline bool isSuppressed(const float *kept_boxes, int max_kept, int kept,
+                                const float *bbox, float bbox_size, float threshold) {
+    const float *kept_xmin = kept_boxes;
+    const float *kept_ymin = kept_boxes + max_kept;
+    const float *kept_xmax = kept_boxes + 2*max_kept;
+    const float *kept_ymax = kept_boxes + 3*max_kept;
+    const float *kept_size = kept_boxes + 4*max_kept;
+
+    int k = 0;
+#if defined(HAVE_AVX2)
+    const __m256 vxmin = _mm256_set1_ps(bbox[0]);
+    const __m256 vymin = _mm256_set1_ps(bbox[1]);
+    const __m256 vxmax = _mm256_set1_ps(bbox[2]);
+    const __m256 vymax = _mm256_set1_ps(bbox[3]);
+    const __m256 vsize = _mm256_set1_ps(bbox_size);
+    const __m256 vthreshold = _mm256_set1_ps(threshold);
+    const __m256 vzero = _mm256_setzero_ps();
+    for (; k + 8 <= kept; k += 8) {
+        __m256 vwidth = _mm256_sub_ps(_mm256_min_ps(vxmax, _mm256_loadu_ps(kept_xmax + k)),
+                                      _mm256_max_ps(vxmin, _mm256_loadu_ps(kept_xmin + k)));
+        __m256 vheight = _mm256_sub_ps(_mm256_min_ps(vymax, _mm256_loadu_ps(kept_ymax + k)),
+                                       _mm256_max_ps(vymin, _mm256_loadu_ps(kept_ymin + k)));
+        __m256 vintersect = _mm256_mul_ps(vwidth, vheight);
+        __m256 voverlap = _mm256_div_ps(vintersect,
+                                        _mm256_sub_ps(_mm256_add_ps(vsize, _mm256_loadu_ps(kept_size + k)), vintersect));
+        // boxes which don't intersect have zero overlap
+        __m256 vintersects = _mm256_and_ps(_mm256_cmp_ps(vwidth, vzero, _CMP_GT_OQ),
+                                           _mm256_cmp_ps(vheight, vzero, _CMP_GT_OQ));
+        voverlap = _mm256_and_ps(vintersects, voverlap);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(voverlap, vthreshold, _CMP_GT_OQ)))
+            return true;
     }
-
-    float intersect_xmin = std::max(xmin1, xmin2);
-    float intersect_ymin = std::max(ymin1, ymin2);
-    float intersect_xmax = std::min(xmax1, xmax2);
-    float intersect_ymax = std::min(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
+#endif
+    for (; k < kept; ++k) {
+        float intersect_width  = std::min(bbox[2], kept_xmax[k]) - std::max(bbox[0], kept_xmin[k]);
+        float intersect_height = std::min(bbox[3], kept_ymax[k]) - std::max(bbox[1], kept_ymin[k]);
+
+        float overlap = 0.0f;
+        if (intersect_width > 0 && intersect_height > 0) {
+            float intersect_size = intersect_width * intersect_height;
+            overlap = intersect_size / (bbox_size + kept_size[k] - intersect_size);
+        }
+        if (overlap > threshold)
+            return true;
     }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+    return false;
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
-                                   const float *loc_data,
-                                   const float *variance_data,
-                                   float *decoded_bboxes,
-                                   float *decoded_bbox_sizes,
-                                   int* num_priors_actual,
-                                   int n) {
-    num_priors_actual[n] = _num_priors;
+void DetectionOutputImpl::decodeBBox(const float *prior,
+                                     const float *loc,
+                                     const float *variance,
+                                     float *decoded_bbox,
+                                     float &decoded_bbox_size) {
+    float new_xmin = 0.0f;
+    float new_ymin = 0.0f;
+    float new_xmax = 0.0f;
+    float new_ymax = 0.0f;
+
+    float prior_xmin = prior[0 + _offset];
+    float prior_ymin = prior[1 + _offset];
+    float prior_xmax = prior[2 + _offset];
+    float prior_ymax = prior[3 + _offset];
+
+    float loc_xmin = loc[0];
+    float loc_ymin = loc[1];
+    float loc_xmax = loc[2];
+    float loc_ymax = loc[3];
+
     if (!_normalized) {
-        int num = 0;
-        for (; num < _num_priors; ++num) {
-            float batch_id = prior_data[num * _prior_size + 0];
-            if (batch_id == -1.f) {
-                num_priors_actual[n] = num;
-                break;
-            }
-        }
+        prior_xmin /= _image_width;
+        prior_ymin /= _image_height;
+        prior_xmax /= _image_width;
+        prior_ymax /= _image_height;
     }
 
-    #pragma omp parallel for schedule(static)
-    for (int p = 0; p < num_priors_actual[n]; ++p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*_prior_size + 0 + _offset];
-        float prior_ymin = prior_data[p*_prior_size + 1 + _offset];
-        float prior_xmax = prior_data[p*_prior_size + 2 + _offset];
-        float prior_ymax = prior_data[p*_prior_size + 3 + _offset];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
-
-        if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
+    if (_code_type == CodeType::CORNER) {
+        if (_variance_encoded_in_target) {
+            // variance is encoded in target, we simply need to add the offset predictions.
+            new_xmin = prior_xmin + loc_xmin;
+            new_ymin = prior_ymin + loc_ymin;
+            new_xmax = prior_xmax + loc_xmax;
+            new_ymax = prior_ymax + loc_ymax;
+        } else {
+            new_xmin = prior_xmin + variance[0] * loc_xmin;
+            new_ymin = prior_ymin + variance[1] * loc_ymin;
+            new_xmax = prior_xmax + variance[2] * loc_xmax;
+            new_ymax = prior_ymax + variance[3] * loc_ymax;
         }
-
-        if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
-            } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
-            }
-        } else if (_code_type == CodeType::CENTER_SIZE) {
-            float prior_width    =  prior_xmax - prior_xmin;
-            float prior_height   =  prior_ymax - prior_ymin;
-            float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
-            float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
-
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
-
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
-            }
-
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
-        }
-
-        if (_clip) {
-            new_xmin = std::max(0.0f, std::min(1.0f, new_xmin));
-            new_ymin = std::max(0.0f, std::min(1.0f, new_ymin));
-            new_xmax = std::max(0.0f, std::min(1.0f, new_xmax));
-            new_ymax = std::max(0.0f, std::min(1.0f, new_ymax));
+    } else if (_code_type == CodeType::CENTER_SIZE) {
+        float prior_width    =  prior_xmax - prior_xmin;
+        float prior_height   =  prior_ymax - prior_ymin;
+        float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
+        float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
+
+        float decode_bbox_center_x, decode_bbox_center_y;
+        float decode_bbox_width, decode_bbox_height;
+
+        if (_variance_encoded_in_target) {
+            // variance is encoded in target, we simply need to restore the offset predictions.
+            decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
+            decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
+            decode_bbox_width  = std::exp(loc_xmax) * prior_width;
+            decode_bbox_height = std::exp(loc_ymax) * prior_height;
+        } else {
+            // variance is encoded in bbox, we need to scale the offset accordingly.
+            decode_bbox_center_x = variance[0] * loc_xmin * prior_width + prior_center_x;
+            decode_bbox_center_y = variance[1] * loc_ymin * prior_height + prior_center_y;
+            decode_bbox_width    = std::exp(variance[2] * loc_xmax) * prior_width;
+            decode_bbox_height   = std::exp(variance[3] * loc_ymax) * prior_height;
         }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
+        new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
+        new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
+        new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
+        new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
+    }
 
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
+    if (_clip) {
+        new_xmin = std::max(0.0f, std::min(1.0f, new_xmin));
+        new_ymin = std::max(0.0f, std::min(1.0f, new_ymin));
+        new_xmax = std::max(0.0f, std::min(1.0f, new_xmax));
+        new_ymax = std::max(0.0f, std::min(1.0f, new_ymax));
     }
+
+    decoded_bbox[0] = new_xmin;
+    decoded_bbox[1] = new_ymin;
+    decoded_bbox[2] = new_xmax;
+    decoded_bbox[3] = new_ymax;
+
+    decoded_bbox_size = (new_xmax - new_xmin) * (new_ymax - new_ymin);
 }
 
 void DetectionOutputImpl::nms(const float* conf_data,
@@ -486,14 +479,15 @@ void DetectionOutputImpl::nms(const float* conf_data,
                           const float* sizes,
                           int* buffer,
                           int* indices,
+                          float* kept_boxes,
                           int& detections,
                           int num_priors_actual) {
+    // The index is always written and the count only grows for confident priors,
+    // so the loop has no branches and is vectorized
     int count = 0;
     for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
+        indices[count] = i;
+        count += conf_data[i] > _confidence_threshold;
     }
 
     int num_output_scores = (_top_k == -1 ? count : std::min<int>(_top_k, count));
@@ -504,23 +498,66 @@ void DetectionOutputImpl::nms(const float* conf_data,
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        const float *bbox = bboxes + idx*4;
+
+        if (!isSuppressed(kept_boxes, _max_kept, detections, bbox, sizes[idx], _nms_threshold)) {
+            kept_boxes[detections] = bbox[0];
+            kept_boxes[_max_kept + detections] = bbox[1];
+            kept_boxes[2*_max_kept + detections] = bbox[2];
+            kept_boxes[3*_max_kept + detections] = bbox[3];
+            kept_boxes[4*_max_kept + detections] = sizes[idx];
             indices[detections] = idx;
             detections++;
         }
     }
 }
 
+void DetectionOutputImpl::keepTopK(const float *conf_data,
+                                   int *indices,
+                                   int *detections,
+                                   ScoredDetection *top_detections) {
+    int detections_total = 0;
+    for (int c = 0; c < _num_classes; ++c) {
+        detections_total += detections[c];
+    }
+    if (detections_total <= _keep_top_k) {
+        return;
+    }
+
+    // Higher confidence first, ties are broken by the label and the prior
+    auto better = [](const ScoredDetection &a, const ScoredDetection &b) {
+        if (a.conf != b.conf) return a.conf > b.conf;
+        if (a.label != b.label) return a.label < b.label;
+        return a.idx < b.idx;
+    };
+
+    // The worst of the best detections found so far is on top of the heap
+    int size = 0;
+    for (int c = 0; c < _num_classes && _keep_top_k > 0; ++c) {
+        const int *pindices = indices + c*_num_priors;
+        for (int i = 0; i < detections[c]; ++i) {
+            ScoredDetection detection = {conf_data[c*_num_priors + pindices[i]], c, pindices[i]};
+            if (size < _keep_top_k) {
+                top_detections[size++] = detection;
+                std::push_heap(top_detections, top_detections + size, better);
+            } else if (better(detection, top_detections[0])) {
+                std::pop_heap(top_detections, top_detections + size, better);
+                top_detections[size - 1] = detection;
+                std::push_heap(top_detections, top_detections + size, better);
+            }
+        }
+    }
+    std::sort_heap(top_detections, top_detections + size, better);
+
+    // Store the new indices.
+    memset(detections, 0, _num_classes * sizeof(int));
+    for (int j = 0; j < size; ++j) {
+        int label = top_detections[j].label;
+        indices[label*_num_priors + detections[label]] = top_detections[j].idx;
+        detections[label]++;
+    }
+}
+
 REG_FACTORY_FOR(ImplFactory<DetectionOutputImpl>, DetectionOutput);
 
 }  // namespace Cpu
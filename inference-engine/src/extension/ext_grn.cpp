@@ -5,8 +5,10 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <cmath>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -24,6 +26,11 @@ public:
             bias = layer->GetParamAsFloat("bias");
 
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+                // channel blocked layouts of convolutions, so that the layer doesn't need reorders around it
+                addConfig(layer, {{ConfLayout::BLK8, false, 0}}, {{ConfLayout::BLK8, false, 0}});
+                addConfig(layer, {{ConfLayout::BLK16, false, 0}}, {{ConfLayout::BLK16, false, 0}});
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -41,25 +48,32 @@ public:
         int H = static_cast<int>((dims.size() > 2) ? dims[2] : 1);
         int W = static_cast<int>((dims.size() > 3) ? dims[3] : 1);
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(3) schedule(static)
-#endif
-        for (int b = 0; b < N; b++) {
-            for (int h = 0; h < H; h++) {
-                for (int w = 0; w < W; w++) {
-                    double variance = 0;
-                    for (int c = 0; c < C; c++) {
-                        variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
-                    }
-                    variance = std::pow(variance + bias, 0.5f);
-                    for (int c = 0; c < C; c++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / variance;
-                    }
+        // Planar data is handled as blocks of a single channel, padding channels of the last block are set to zero
+        const SizeVector &blk_dims = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        const int blk_size = blk_dims.size() == 5 ? static_cast<int>(blk_dims[4]) : 1;
+        const int CB = (C + blk_size - 1) / blk_size;
+
+        parallel_for3d(N, H, W, [&](int b, int h, int w) {
+            const float *psrc = src_data + b*CB*H*W*blk_size + (h*W + w)*blk_size;
+            float *pdst = dst_data + b*CB*H*W*blk_size + (h*W + w)*blk_size;
+
+            double variance = 0;
+            for (int cb = 0; cb < CB; cb++) {
+                for (int c = 0; c < std::min(blk_size, C - cb*blk_size); c++) {
+                    variance += std::pow(psrc[cb*H*W*blk_size + c], 2);
                 }
             }
-        }
+            variance = std::pow(variance + bias, 0.5f);
+            for (int cb = 0; cb < CB; cb++) {
+                const int blk = std::min(blk_size, C - cb*blk_size);
+                for (int c = 0; c < blk; c++) {
+                    pdst[cb*H*W*blk_size + c] = psrc[cb*H*W*blk_size + c] / variance;
+                }
+                for (int c = blk; c < blk_size; c++) {
+                    pdst[cb*H*W*blk_size + c] = 0.0f;
+                }
+            }
+        });
         return OK;
     }
 
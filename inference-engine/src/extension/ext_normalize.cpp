@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <algorithm>
 #include <string>
@@ -32,6 +33,10 @@ public:
             eps = layer->GetParamAsFloat("eps");
 
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+                addConfig(layer, {{ConfLayout::BLK8, false, 0}}, {{ConfLayout::BLK8, false, 0}}, true);
+                addConfig(layer, {{ConfLayout::BLK16, false, 0}}, {{ConfLayout::BLK16, false, 0}}, true);
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -79,8 +84,11 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
-        const int HW = H*W;
-        const int CHW = C*HW;
+        const SizeVector &blk_dims = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        if (blk_dims.size() == 5) {
+            normalize_blk(src, scl, dst, N, C, H, W, static_cast<int>(blk_dims[4]));
+            return OK;
+        }
 
         for (int n = 0; n < N; n++) {
             const float* psrc = src + n*C*H*W;
@@ -212,6 +220,8 @@ public:
     }
 
 private:
+    void normalize_blk(const float* src, const float* scl, float* dst, int N, int C, int H, int W, int blk_size);
+
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
@@ -219,6 +229,69 @@ private:
     float eps = 1e-10;
 };
 
+// Channels are split into blocks of blk_size, the channels of a block are consecutive in memory.
+// Padding channels of the last block are set to zero, as the layers consuming blocked data expect.
+void NormalizeImpl::normalize_blk(const float* src, const float* scl, float* dst,
+                                  int N, int C, int H, int W, int blk_size) {
+    const int CB = (C + blk_size - 1) / blk_size;
+    const int HW = H*W;
+
+    for (int n = 0; n < N; n++) {
+        const float* psrc = src + n*CB*HW*blk_size;
+        float* pdst = dst + n*CB*HW*blk_size;
+
+        if (across_spatial) {
+            float norm = eps;
+            for (int cb = 0; cb < CB; cb++) {
+                const int blk = std::min(blk_size, C - cb*blk_size);
+                for (int hw = 0; hw < HW; hw++) {
+                    const float* psrc_blk = psrc + (cb*HW + hw)*blk_size;
+                    for (int c = 0; c < blk; c++) {
+                        norm += psrc_blk[c]*psrc_blk[c];
+                    }
+                }
+            }
+            norm = 1.0f / std::sqrt(norm);
+
+            parallel_for2d(CB, HW, [&](int cb, int hw) {
+                const int blk = std::min(blk_size, C - cb*blk_size);
+                const float* psrc_blk = psrc + (cb*HW + hw)*blk_size;
+                float* pdst_blk = pdst + (cb*HW + hw)*blk_size;
+                for (int c = 0; c < blk; c++) {
+                    pdst_blk[c] = psrc_blk[c] * norm * (channel_shared ? scl[0] : scl[cb*blk_size + c]);
+                }
+                for (int c = blk; c < blk_size; c++) {
+                    pdst_blk[c] = 0.0f;
+                }
+            });
+        } else {
+            parallel_for(HW, [&](int hw) {
+                float norm = eps;
+                for (int cb = 0; cb < CB; cb++) {
+                    const int blk = std::min(blk_size, C - cb*blk_size);
+                    const float* psrc_blk = psrc + (cb*HW + hw)*blk_size;
+                    for (int c = 0; c < blk; c++) {
+                        norm += psrc_blk[c]*psrc_blk[c];
+                    }
+                }
+                norm = 1.0f / std::sqrt(norm);
+
+                for (int cb = 0; cb < CB; cb++) {
+                    const int blk = std::min(blk_size, C - cb*blk_size);
+                    const float* psrc_blk = psrc + (cb*HW + hw)*blk_size;
+                    float* pdst_blk = pdst + (cb*HW + hw)*blk_size;
+                    for (int c = 0; c < blk; c++) {
+                        pdst_blk[c] = psrc_blk[c] * norm * (channel_shared ? scl[0] : scl[cb*blk_size + c]);
+                    }
+                    for (int c = blk; c < blk_size; c++) {
+                        pdst_blk[c] = 0.0f;
+                    }
+                }
+            });
+        }
+    }
+}
+
 class NormalizeShapeInfer : public IShapeInferImpl {
 public:
     StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
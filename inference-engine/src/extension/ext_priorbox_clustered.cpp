@@ -30,7 +30,7 @@ public:
             step_w_ = layer->GetParamAsFloat("step_w", 0);
             offset_ = layer->GetParamAsFloat("offset");
 
-            addConfig(layer, {{ConfLayout::PLN, true}, {ConfLayout::PLN, true}}, {{ConfLayout::PLN, true}});
+            addConfig(layer, {{ConfLayout::ANY, true}, {ConfLayout::ANY, true}}, {{ConfLayout::PLN, true}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 #include <cmath>
 #include <vector>
 #include <string>
@@ -59,8 +60,7 @@ public:
             }
         }
 
-        #pragma omp parallel for schedule(static)
-        for (int n = 0; n < real_rois; n++) {
+        parallel_for(real_rois, [&](int n) {
             const float* bottom_rois = bottom_rois_beginning + n * 5;
             int roi_batch_ind = static_cast<int>(bottom_rois[0]);
             float roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
@@ -109,10 +109,10 @@ public:
                     }
                 }
             }
-        }
+        });
 
-        #pragma omp parallel for schedule(static)
-        for (int n = real_rois; n < nn; n++) {
+        parallel_for(nn - real_rois, [&](int i) {
+            int n = real_rois + i;
             for (int c = 0; c < nc; c++) {
                 for (int h = 0; h < nh; h++) {
                     for (int w = 0; w < nw; w++) {
@@ -121,7 +121,7 @@ public:
                     }
                 }
             }
-        }
+        });
 
         return OK;
     }
@@ -7,7 +7,10 @@
 #include "ext_base.hpp"
 #include "defs.h"
 #include "softmax.h"
+#include "ie_parallel.hpp"
 #include <vector>
+#include <cstring>
+#include <algorithm>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -44,42 +47,47 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
-        memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
-
-        int end_index = 0;
-        int num_ = 0;
-        if (do_softmax) {
-            // Region layer (Yolo v2)
-            end_index = IW * IH;
-            num_ = num;
-        } else {
-            // Yolo layer (Yolo v3)
-            end_index = IW * IH * (classes + 1);
-            num_ = mask_size;
+        int num_ = do_softmax ? num : mask_size;
+        int entries = coords + classes + 1;
+        int inputs_size = IH * IW * num_ * entries;
+
+        if (IC * IH * IW != inputs_size) {
+            // channels which don't belong to the anchors are passed through
+            memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
         }
-        int inputs_size = IH * IW * num_ * (classes + coords + 1);
 
-        for (int b = 0; b < B; b++) {
-            for (int n = 0; n < num_; n++) {
-                int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
-                for (int i = index; i < index + 2 * IW * IH; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
+        // Each anchor of each image is split into blocks of positions, every output value is written once
+        const int spatial = IH * IW;
+        const int block = 128;
+        const int blocks_count = (spatial + block - 1) / block;
+        parallel_for2d(B * num_, blocks_count, [&](int bn, int ib) {
+            int b = bn / num_;
+            int n = bn % num_;
+            int start = ib * block;
+            int count = std::min(block, spatial - start);
+
+            int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * spatial, 0) + start;
+            const float *psrc = src_data + index;
+            float *pdst = dst_data + index;
+
+            // x and y of the box
+            calculate_logistic(psrc, pdst, count);
+            calculate_logistic(psrc + spatial, pdst + spatial, count);
+            for (int e = 2; e < coords; e++) {
+                memcpy(pdst + e * spatial, psrc + e * spatial, count * sizeof(float));
+            }
 
-                index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
-                for (int i = index; i < index + end_index; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
+            if (do_softmax) {
+                // Region layer (Yolo v2): logistic objectness and softmax of classes
+                calculate_logistic(psrc + coords * spatial, pdst + coords * spatial, count);
+                softmax_positions(psrc + (coords + 1) * spatial, pdst + (coords + 1) * spatial, classes, spatial, count);
+            } else {
+                // Yolo layer (Yolo v3): logistic objectness and classes
+                for (int e = coords; e < entries; e++) {
+                    calculate_logistic(psrc + e * spatial, pdst + e * spatial, count);
                 }
             }
-        }
-
-        if (do_softmax) {
-            int index = entry_index(IW, IH, coords, classes, inputs_size, 0, 0, coords + 1);
-            int batch_offset = inputs_size / num;
-            for (int b = 0; b < B * num; b++)
-                softmax_generic(src_data + index + b * batch_offset, dst_data + index + b * batch_offset, 1, classes,
-                                IH, IW);
-        }
+        });
 
         return OK;
     }
@@ -102,6 +110,36 @@ private:
     inline float logistic_activate(float x) {
         return 1.f / (1.f + exp(-x));
     }
+
+    inline void calculate_logistic(const float *src, float *dst, int count) {
+        int i = 0;
+#if defined(HAVE_AVX2)
+        const __m256 vone = _mm256_set1_ps(1.f);
+        for (; i + 8 <= count; i += 8) {
+            __m256 vneg = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(src + i));
+#if USE_FAST_EXP
+            __m256 vexp = _avx_fast_exp_ps(vneg);
+#else
+            __m256 vexp = _avx_opt_exp_ps(vneg);
+#endif
+            _mm256_storeu_ps(dst + i, _mm256_div_ps(vone, _mm256_add_ps(vone, vexp)));
+        }
+#elif defined(HAVE_SSE)
+        const __m128 vone = _mm_set1_ps(1.f);
+        for (; i + 4 <= count; i += 4) {
+            __m128 vneg = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(src + i));
+#if USE_FAST_EXP
+            __m128 vexp = _sse_fast_exp_ps(vneg);
+#else
+            __m128 vexp = _sse_opt_exp_ps(vneg);
+#endif
+            _mm_storeu_ps(dst + i, _mm_div_ps(vone, _mm_add_ps(vone, vexp)));
+        }
+#endif
+        for (; i < count; i++) {
+            dst[i] = logistic_activate(src[i]);
+        }
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<RegionYoloImpl>, RegionYolo);
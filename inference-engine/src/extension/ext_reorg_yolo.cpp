@@ -5,6 +5,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 #include <vector>
 
 namespace InferenceEngine {
@@ -39,25 +40,20 @@ public:
         int ic_off = IC / (stride * stride);
         int ih_off = IH * stride;
         int iw_off = IW * stride;
-        for (int b = 0; b < B; b++) {
-            for (int ic = 0; ic < IC; ic++) {
-                for (int ih = 0; ih < IH; ih++) {
-                    for (int iw = 0; iw < IW; iw++) {
-                        int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
+        parallel_for2d(B, IC, [&](int b, int ic) {
+            int oc = ic % ic_off;
+            int offset = ic / ic_off;
 
-                        int oc = ic % ic_off;
-                        int offset = ic / ic_off;
+            const float *psrc = src_data + b * ic_off * ih_off * iw_off + oc * ih_off * iw_off +
+                                (offset / stride) * iw_off + offset % stride;
+            float *pdst = dst_data + b * IC * IH * IW + ic * IH * IW;
 
-                        int ow = iw * stride + offset % stride;
-                        int oh = ih * stride + offset / stride;
-
-                        int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
-
-                        dst_data[dstIndex] = src_data[srcIndex];
-                    }
+            for (int ih = 0; ih < IH; ih++) {
+                for (int iw = 0; iw < IW; iw++) {
+                    pdst[ih * IW + iw] = psrc[ih * stride * iw_off + iw * stride];
                 }
             }
-        }
+        });
         return OK;
     }
 
@@ -5,6 +5,8 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
+#include "interpolation.h"
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -37,8 +39,7 @@ public:
             auto blk_layout = ConfLayout::BLK8;
 #endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
-            if (type == "caffe.ResampleParameter.NEAREST")
-                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+            addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -61,8 +62,13 @@ public:
         size_t OH = outputs[0]->getTensorDesc().getDims()[2];
         size_t OW = outputs[0]->getTensorDesc().getDims()[3];
 
+        // Planar data is handled as blocks of a single channel
+        const SizeVector &blk_dims = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        int blk_size = blk_dims.size() == 5 ? static_cast<int>(blk_dims[4]) : 1;
+        int CB = div_up(static_cast<int>(IC), blk_size);
+
         if (IW == OW && IH == OH && type == "caffe.ResampleParameter.LINEAR") {
-            memcpy(dst_data, src_data, IN * IC * IH * IW * sizeof(float));
+            memcpy(dst_data, src_data, IN * CB * blk_size * IH * IW * sizeof(float));
             return OK;
         }
 
@@ -78,136 +84,73 @@ public:
                 } else {
                     Upsample_Nearest_BLK<4>(src_data, dst_data, IN, IC, IH, IW);
                 }
+                return OK;
             } else if (!isDownsample && fx == 0.5f && fy == 0.5f) {
                 if (layout == NCHW) {
                     Upsample_Nearest_PLN<2>(src_data, dst_data, IN, IC, IH, IW);
                 } else {
                     Upsample_Nearest_BLK<2>(src_data, dst_data, IN, IC, IH, IW);
                 }
-            } else {
-                if (layout == NCHW) {
-                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
-                } else {
-                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
-                }
+                return OK;
             }
         } else if (type == "caffe.ResampleParameter.LINEAR") {
-            size_t kernel_width = 2;
-
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
-            if (!isDownsample && fx == 0.25f && fy == 0.25f)
+            if (!isDownsample && fx == 0.25f && fy == 0.25f && layout == NCHW) {
                 Upsample4x_TriangleInterpolation(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN);
-            else
+                return OK;
+            }
 #endif
-                InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias);
+        } else {
+            return OK;
         }
-        return OK;
-    }
-
-private:
-    std::string type;
-    bool antialias;
-
-    static inline float triangleCoeff(float x) {
-        return std::max(0.0f, 1 - std::abs(x));
-    }
-
-    static void InterpolationKernel(const float *in_ptr_,
-                                    const size_t iw, const size_t ih,
-                                    const float fx, const float fy,
-                                    float *out_ptr_,
-                                    const size_t ow, const size_t oh, const size_t channels, const size_t batch,
-                                    size_t kernel_width, bool antialias) {
-        for (size_t b = 0; b < batch; b++) {
-            for (size_t c = 0; c < channels; c++) {
-                const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
-                float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
 
-                for (size_t oy = 0; oy < oh; oy++) {
-                    for (size_t ox = 0; ox < ow; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-
-                        float sum = 0;
-                        float wsum = 0;
-
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
-
-                        int rx = (fx < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ax);
-                        int ry = (fy < 1.0f) ? 2 : ceil(static_cast<float>(kernel_width) / ay);
-
-                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                if (y < 0 || x < 0 || y >= static_cast<int>(ih) || x >= static_cast<int>(iw))
-                                    continue;
-
-                                float dx = ix - x;
-                                float dy = iy - y;
-
-                                float w = ax * triangleCoeff(ax * dx) * ay * triangleCoeff(ay * dy);
-
-                                sum += w * in_ptr[y * iw + x];
-                                wsum += w;
-                            }
-                        }
-
-                        out_ptr[oy * ow + ox] = (!wsum) ? 0 : (sum / wsum);
-                    }
-                }
-            }
+        if (IH != table_ih || IW != table_iw || OH != table_oh || OW != table_ow) {
+            buildTables(IH, IW, OH, OW, fx, fy, isDownsample);
+            table_ih = IH;
+            table_iw = IW;
+            table_oh = OH;
+            table_ow = OW;
         }
-    }
-
-    static void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        for (size_t b = 0; b < B; b++) {
-            for (size_t c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
-                float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
 
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
-
-                        out_ptr[oy * OW + ox] = in_ptr[iy_r * IW + ix_r];
-                    }
-                }
+        if (!interpolate(src_data, dst_data, IN, CB, blk_size, IH, IW, OH, OW, table_y, table_x)) {
+            if (resp) {
+                std::string errorMsg = "Resample doesn't support blocks of " + std::to_string(blk_size) + " channels";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             }
+            return NOT_IMPLEMENTED;
         }
+        return OK;
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        int blk_size = 8;
-        size_t CB = (size_t)div_up(C, blk_size);
+private:
+    std::string type;
+    bool antialias;
 
-        for (size_t b = 0; b < B; b++) {
-            for (size_t cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+    // Tables of the last input and output sizes
+    InterpolationTable table_y;
+    InterpolationTable table_x;
+    size_t table_ih = 0;
+    size_t table_iw = 0;
+    size_t table_oh = 0;
+    size_t table_ow = 0;
 
-                for (size_t oy = 0; oy < OH; oy++) {
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+    // Note that the source coordinates along x are shifted by a half of fy and the ones along y by a half of fx
+    void buildTables(int IH, int IW, int OH, int OW, float fx, float fy, bool isDownsample) {
+        if (type == "caffe.ResampleParameter.NEAREST") {
+            build_nearest_table(table_x, IW, OW, fx, fy / 2.0f);
+            build_nearest_table(table_y, IH, OH, fy, fx / 2.0f);
+        } else {
+            const int kernel_width = 2;
+            bool isAntialias = isDownsample && antialias;
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+            float ax = 1.0f / (isAntialias ? fx : 1.0f);
+            float ay = 1.0f / (isAntialias ? fy : 1.0f);
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
+            int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
+            int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
 
-                            out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
-                        }
-                    }
-                }
-            }
+            build_triangle_table(table_x, IW, OW, fx, fy / 2.0f, ax, rx);
+            build_triangle_table(table_y, IH, OH, fy, fx / 2.0f, ay, ry);
         }
     }
 
@@ -257,54 +200,47 @@ private:
         int OH = factor * IH;
         int OW = factor * IW;
 
-#if _MSC_VER && !__INTEL_COMPILER
-        #pragma omp parallel for schedule(static)
-#else
-        #pragma omp parallel for collapse(2) schedule(static)
-#endif
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
+        parallel_for2d(B, CB, [&](int b, int cb) {
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (size_t iy = 0; iy < IH; iy++) {
-                    for (size_t ix = 0; ix < IW; ix++) {
-                        size_t oy = factor * iy;
-                        size_t ox = factor * ix;
+            for (size_t iy = 0; iy < IH; iy++) {
+                for (size_t ix = 0; ix < IW; ix++) {
+                    size_t oy = factor * iy;
+                    size_t ox = factor * ix;
 
-                        vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
+                    vec_type vsrc = _mm_uni_loadu_ps(in_ptr + iy * IW * blk_size + ix * blk_size);
 
-                        for (int fh = 0; fh < factor; fh++) {
-                            for (int fw = 0; fw < factor; fw++) {
-                                _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
-                            }
+                    for (int fh = 0; fh < factor; fh++) {
+                        for (int fw = 0; fw < factor; fw++) {
+                            _mm_uni_storeu_ps(out_ptr + (oy + fh) * OW * blk_size + (ox + fw) * blk_size, vsrc);
                         }
                     }
                 }
+            }
 #else
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
 
-                for (int iy = 0; iy < IH; iy++) {
-                    for (int ix = 0; ix < IW; ix++) {
-                        int oy = factor * iy;
-                        int ox = factor * ix;
+            for (int iy = 0; iy < IH; iy++) {
+                for (int ix = 0; ix < IW; ix++) {
+                    int oy = factor * iy;
+                    int ox = factor * ix;
 
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
+                    for (int c = 0; c < blk_size; c++) {
+                        float value = in_ptr[iy * IW * blk_size + ix * blk_size + c];
 
-                            for (int fh = 0; fh < factor; fh++) {
-                                for (int fw = 0; fw < factor; fw++) {
-                                    out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
-                                }
+                        for (int fh = 0; fh < factor; fh++) {
+                            for (int fw = 0; fw < factor; fw++) {
+                                out_ptr[(oy + fh) * OW * blk_size + (ox + fw) * blk_size + c] = value;
                             }
                         }
                     }
                 }
-#endif
             }
-        }
+#endif
+        });
     }
 
 
@@ -0,0 +1,193 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_placement.h"
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+#include <caseless.hpp>
+#include <graph_tools.hpp>
+#include <details/ie_exception.hpp>
+
+using namespace InferenceEngine;
+
+void LayerCosts::set(const std::string &device, const std::string &layer, double micros) {
+    _costs[device][layer] = micros;
+}
+
+bool LayerCosts::get(const std::string &device, const std::string &layer, double &micros) const {
+    auto d = _costs.find(device);
+    if (d == _costs.end())
+        return false;
+    auto l = d->second.find(layer);
+    if (l == d->second.end())
+        return false;
+    micros = l->second;
+    return true;
+}
+
+bool LayerCosts::hasDevice(const std::string &device) const {
+    return _costs.find(device) != _costs.end();
+}
+
+void LayerCosts::load(std::istream &stream) {
+    std::string line;
+    while (std::getline(stream, line)) {
+        std::istringstream fields(line);
+        std::string device, layer;
+        double micros = 0;
+        if (!(fields >> device >> micros))
+            continue;
+        std::getline(fields >> std::ws, layer);
+        if (!layer.empty())
+            set(device, layer, micros);
+    }
+}
+
+void LayerCosts::save(std::ostream &stream) const {
+    for (auto &&device : _costs) {
+        for (auto &&layer : device.second) {
+            stream << device.first << " " << layer.second << " " << layer.first << std::endl;
+        }
+    }
+}
+
+double InferenceEngine::placeByCost(ICNNNetwork &network,
+                                    const std::vector<std::string> &devices,
+                                    const std::map<std::string, std::set<std::string>> &supportedLayers,
+                                    const LayerCosts &costs,
+                                    double transferMicrosPerMB,
+                                    size_t maxSegments) {
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    std::vector<CNNLayerPtr> layers;
+    std::vector<CNNLayerPtr> inputs;
+    for (auto &&layer : CNNNetSortTopologically(network)) {
+        if (CaselessEq<std::string>()(layer->type, "input")) {
+            inputs.push_back(layer);
+        } else {
+            layers.push_back(layer);
+        }
+    }
+    size_t n = layers.size();
+    if (n == 0 || devices.empty())
+        return 0;
+
+    std::map<std::string, size_t> position;
+    for (size_t i = 0; i < n; i++)
+        position[layers[i]->name] = i;
+
+    // Execution costs, infinite on devices which don't support the layer
+    std::vector<std::vector<double>> cost(n, std::vector<double>(devices.size(), infinity));
+    std::vector<bool> placeable(n, false);
+    for (size_t i = 0; i < n; i++) {
+        double slowest = 0;
+        for (auto &&device : devices) {
+            double micros;
+            if (costs.get(device, layers[i]->name, micros))
+                slowest = std::max(slowest, micros);
+        }
+        for (size_t d = 0; d < devices.size(); d++) {
+            auto supported = supportedLayers.find(devices[d]);
+            if (supported == supportedLayers.end() || !supported->second.count(layers[i]->name))
+                continue;
+            double micros;
+            cost[i][d] = costs.get(devices[d], layers[i]->name, micros) ? micros : slowest;
+            placeable[i] = true;
+        }
+        // the layer is reported by the caller, it must not decide the placement of the others
+        if (!placeable[i])
+            std::fill(cost[i].begin(), cost[i].end(), 0.0);
+    }
+
+    // Bytes of data alive between the layers i - 1 and i
+    std::vector<double> alive(n + 1, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        for (auto &&data : layers[i]->outData) {
+            size_t last = i;
+            for (auto &&consumer : data->getInputTo()) {
+                auto p = position.find(consumer.second->name);
+                if (p != position.end())
+                    last = std::max(last, p->second);
+            }
+            if (last == i)
+                continue;
+            auto &dims = data->getTensorDesc().getDims();
+            double bytes = static_cast<double>(data->getTensorDesc().getPrecision().size()) *
+                    std::accumulate(dims.begin(), dims.end(), 1.0, std::multiplies<double>());
+            alive[i + 1] += bytes;
+            alive[last + 1] -= bytes;
+        }
+    }
+    std::partial_sum(alive.begin(), alive.end(), alive.begin());
+
+    // total[i][d * segments + k] is the minimal cost of the layers 0..i with the layer i on the device d
+    // in the segment k. Without a limit segments are not counted and k is always 0.
+    size_t segments = maxSegments ? std::min(maxSegments, n) : 1;
+    size_t states = devices.size() * segments;
+    std::vector<std::vector<double>> total(n, std::vector<double>(states, infinity));
+    std::vector<std::vector<size_t>> from(n, std::vector<size_t>(states, 0));
+    for (size_t d = 0; d < devices.size(); d++)
+        total[0][d * segments] = cost[0][d];
+
+    for (size_t i = 1; i < n; i++) {
+        double transfer = alive[i] / (1024 * 1024) * transferMicrosPerMB;
+        for (size_t d = 0; d < devices.size(); d++) {
+            if (cost[i][d] == infinity)
+                continue;
+            for (size_t k = 0; k < segments; k++) {
+                size_t state = d * segments + k;
+                double best = total[i - 1][state];
+                size_t bestFrom = state;
+                if (!maxSegments || k > 0) {
+                    size_t previousSegment = maxSegments ? k - 1 : k;
+                    for (size_t previous = 0; previous < devices.size(); previous++) {
+                        if (previous == d)
+                            continue;
+                        size_t previousState = previous * segments + previousSegment;
+                        if (total[i - 1][previousState] + transfer < best) {
+                            best = total[i - 1][previousState] + transfer;
+                            bestFrom = previousState;
+                        }
+                    }
+                }
+                total[i][state] = best + cost[i][d];
+                from[i][state] = bestFrom;
+            }
+        }
+    }
+
+    size_t state = 0;
+    for (size_t s = 1; s < states; s++) {
+        if (total[n - 1][s] < total[n - 1][state])
+            state = s;
+    }
+    double result = total[n - 1][state];
+    if (result == infinity) {
+        THROW_IE_EXCEPTION << "Layers of the network cannot be assigned to " << maxSegments
+                           << " subgraphs on the fallback devices";
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        if (placeable[i])
+            layers[i]->affinity = devices[state / segments];
+        state = from[i][state];
+    }
+    for (auto &&input : inputs) {
+        input->affinity.clear();
+        for (auto &&data : input->outData) {
+            for (auto &&consumer : data->getInputTo()) {
+                if (input->affinity.empty())
+                    input->affinity = consumer.second->affinity;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for cost based assignment of layers to devices
+ * @file cost_placement.h
+ */
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <set>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <ie_icnn_network.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @class LayerCosts
+ * @brief Measured execution times of layers on devices in microseconds
+ */
+class LayerCosts {
+public:
+    void set(const std::string &device, const std::string &layer, double micros);
+
+    /**
+     * @return false if there is no time for the layer on the device
+     */
+    bool get(const std::string &device, const std::string &layer, double &micros) const;
+
+    bool hasDevice(const std::string &device) const;
+
+    /**
+     * @brief Reads lines of a device, a time and a layer name separated by spaces
+     */
+    void load(std::istream &stream);
+
+    void save(std::ostream &stream) const;
+
+private:
+    std::map<std::string, std::map<std::string, double>> _costs;
+};
+
+/**
+ * @brief Assigns the layers of the network to the devices so that the sum of the layer costs and of the costs to pass
+ * data between devices is minimal. Layers are assigned in the topological order as segments: a layer on another
+ * device than the previous one starts a new segment and costs the transfer of all the data which is alive between
+ * the two layers.
+ * A layer without a cost on a device which supports it costs as much as the slowest device it has a cost for.
+ * Layers not supported by any device are left without affinity, Input layers get the affinity of their consumers.
+ * @param devices Devices in order of preference, it decides between placements of equal cost
+ * @param supportedLayers Layers supported by each device
+ * @param transferMicrosPerMB Cost of passing one megabyte between devices
+ * @param maxSegments Maximum number of segments, 0 for no limit
+ * @return Total cost of the placement
+ */
+double placeByCost(ICNNNetwork &network,
+                   const std::vector<std::string> &devices,
+                   const std::map<std::string, std::set<std::string>> &supportedLayers,
+                   const LayerCosts &costs,
+                   double transferMicrosPerMB,
+                   size_t maxSegments);
+
+}  // namespace InferenceEngine
@@ -5,14 +5,26 @@
 
 #include "fallback_policy.h"
 #include "hetero_device_loader.h"
+#include "hetero_executable_network.h"
 #include "details/ie_cnn_network_iterator.hpp"
 #include "ie_layers.h"
 #include "ie_util_internal.hpp"
+#include "ie_plugin_config.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include <cstring>
 #include <fstream>
+#include <string>
 #include <vector>
 #include <memory>
 
 using namespace InferenceEngine;
+using namespace InferenceEngine::PluginConfigParams;
+using namespace InferenceEngine::HeteroConfigParams;
+
+namespace {
+// Inferences of a network loaded to measure the execution times of layers
+const int profilingRuns = 5;
+}  // namespace
 
 void dla_layer_colorer(const CNNLayerPtr layer,
                        ordered_properties &printed_properties,
@@ -52,6 +64,7 @@ void FallbackPolicy::init(const std::string &config, const std::map<std::string,
     if (i >= 0) {
         _fallbackDevices.push_back(config.substr(i, config.length() - i));
     }
+    _extensions = extensions;
 
     for (auto d : _fallbackDevices) {
         if (_deviceLoaders.find(d) == _deviceLoaders.end()) {
@@ -73,21 +86,170 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         queryResults[i] = r;
     }
 
-    details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+    auto itPolicy = config.find(KEY_HETERO_AFFINITY_POLICY);
+    std::string policy = itPolicy != config.end() ? itPolicy->second : HETERO_FALLBACK;
+    LayerCosts costs;
+    if (policy == HETERO_COST) {
+        setAffinityByCost(config, network, queryResults, costs);
+    } else if (policy == HETERO_FALLBACK) {
+        details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            for (auto &&j : _fallbackDevices) {
+                auto &qr = queryResults[j];
+                if (qr.supportedLayers.find(layer->name) != qr.supportedLayers.end()) {
+                    layer->affinity = j;
+                    break;
+                }
+            }
+            i++;
+        }
+    } else {
+        THROW_IE_EXCEPTION << "Wrong value " << policy << " for property key " << KEY_HETERO_AFFINITY_POLICY
+                           << ". Expected only " << HETERO_FALLBACK << "/" << HETERO_COST;
+    }
+
+    if (_dumpDotFile) {
+        std::ofstream file("hetero_affinity.dot");
+        saveGraphToDot(network, file, [&](const CNNLayerPtr layer,
+                                          ordered_properties &printed_properties,
+                                          ordered_properties &node_properties) {
+            dla_layer_colorer(layer, printed_properties, node_properties);
+            double micros;
+            if (costs.get(layer->affinity, layer->name, micros)) {
+                printed_properties.insert(printed_properties.begin() + 1,
+                                          std::pair<std::string, std::string>("cost, us", std::to_string(micros)));
+            }
+        });
+    }
+}
+
+void FallbackPolicy::setAffinityByCost(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                                       const std::map<std::string, QueryNetworkResult>& queryResults,
+                                       LayerCosts& costs) {
+    auto itProfile = config.find(KEY_HETERO_COST_PROFILE);
+    std::string profilePath = itProfile != config.end() ? itProfile->second : "";
+    if (!profilePath.empty()) {
+        std::ifstream file(profilePath);
+        if (file)
+            costs.load(file);
+    }
+
+    // The profile may come from another network, a device is profiled again if any of the layers
+    // it supports has no cost
+    bool profiled = false;
+    for (auto &&device : _fallbackDevices) {
+        bool complete = true;
+        for (auto &&layer : queryResults.at(device).supportedLayers) {
+            double micros;
+            if (!costs.get(device, layer, micros)) {
+                complete = false;
+                break;
+            }
+        }
+        if (!complete) {
+            profileDevice(config, network, queryResults, device, costs);
+            profiled = true;
+        }
+    }
+    if (profiled && !profilePath.empty()) {
+        std::ofstream file(profilePath);
+        if (!file)
+            THROW_IE_EXCEPTION << "Cannot write the cost profile to " << profilePath;
+        costs.save(file);
+    }
+
+    double transferCost = 100;
+    auto itTransfer = config.find(KEY_HETERO_TRANSFER_COST);
+    if (itTransfer != config.end()) {
+        transferCost = -1;
+        try {
+            transferCost = std::stod(itTransfer->second);
+        } catch (...) {}
+        if (transferCost < 0)
+            THROW_IE_EXCEPTION << "Wrong value " << itTransfer->second << " for property key "
+                               << KEY_HETERO_TRANSFER_COST << ". Expected only non-negative numbers";
+    }
+
+    int maxSubgraphs = 0;
+    auto itMaxSubgraphs = config.find(KEY_HETERO_MAX_SUBGRAPHS);
+    if (itMaxSubgraphs != config.end()) {
+        maxSubgraphs = -1;
+        try {
+            maxSubgraphs = std::stoi(itMaxSubgraphs->second);
+        } catch (...) {}
+        if (maxSubgraphs < 0)
+            THROW_IE_EXCEPTION << "Wrong value " << itMaxSubgraphs->second << " for property key "
+                               << KEY_HETERO_MAX_SUBGRAPHS << ". Expected only non-negative integers";
+    }
+
+    std::map<std::string, std::set<std::string>> supportedLayers;
+    for (auto &&result : queryResults)
+        supportedLayers[result.first] = result.second.supportedLayers;
+    placeByCost(network, _fallbackDevices, supportedLayers, costs, transferCost, static_cast<size_t>(maxSubgraphs));
+}
+
+void FallbackPolicy::profileDevice(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                                   const std::map<std::string, QueryNetworkResult>& queryResults,
+                                   const std::string& device, LayerCosts& costs) {
+    std::vector<std::string> devices(1, device);
+    devices.insert(devices.end(), _fallbackDevices.begin(), _fallbackDevices.end());
+
+    auto profiledNetwork = cloneNet(network);
+    details::CNNNetworkIterator i(profiledNetwork.get());
     while (i != details::CNNNetworkIterator()) {
         CNNLayer::Ptr layer = *i;
-        for (auto &&j : _fallbackDevices) {
-            auto &qr = queryResults[j];
-            if (qr.supportedLayers.find(layer->name) != qr.supportedLayers.end()) {
-                layer->affinity = j;
+        for (auto &&d : devices) {
+            auto &supported = queryResults.at(d).supportedLayers;
+            if (supported.find(layer->name) != supported.end()) {
+                layer->affinity = d;
                 break;
             }
         }
         i++;
     }
 
-    if (_dumpDotFile) {
-        std::ofstream file("hetero_affinity.dot");
-        saveGraphToDot(network, file, dla_layer_colorer);
+    auto profileConfig = config;
+    // layers already have the affinity, the cost policy must not be applied to the profiled network again
+    profileConfig[KEY_HETERO_AFFINITY_POLICY] = HETERO_FALLBACK;
+    profileConfig[KEY_PERF_COUNT] = YES;
+    profileConfig[KEY_HETERO_PIPELINE] = NO;
+    profileConfig[KEY_HETERO_DUMP_GRAPH_DOT] = NO;
+    auto executable = std::make_shared<HeteroPlugin::HeteroExecutableNetwork>(*profiledNetwork, profileConfig,
+                                                                              _extensions, _deviceLoaders);
+    InputsDataMap inputs;
+    profiledNetwork->getInputsInfo(inputs);
+    OutputsDataMap outputs;
+    profiledNetwork->getOutputsInfo(outputs);
+    auto request = executable->CreateInferRequestImpl(inputs, outputs);
+    for (auto &&input : inputs) {
+        Blob::Ptr blob;
+        request->GetBlob(input.first.c_str(), blob);
+        std::memset(blob->buffer(), 0, blob->byteSize());
+    }
+    for (int run = 0; run < profilingRuns; run++)
+        request->Infer();
+
+    // Layers without counters, e.g. fused into others, cost nothing
+    for (auto &&layer : queryResults.at(device).supportedLayers)
+        costs.set(device, layer, 0);
+
+    std::map<std::string, InferenceEngineProfileInfo> perfMap;
+    request->GetPerformanceCounts(perfMap);
+    for (auto &&counter : perfMap) {
+        // hetero counters are named "subgraphN: <layer>"
+        auto separator = counter.first.find(": ");
+        if (separator == std::string::npos)
+            continue;
+        std::string name = counter.first.substr(separator + 2);
+        CNNLayerPtr layer;
+        ResponseDesc resp;
+        if (profiledNetwork->getLayerByName(name.c_str(), layer, &resp) != OK || layer->affinity != device)
+            continue;
+        if (counter.second.status == InferenceEngineProfileInfo::EXECUTED) {
+            costs.set(device, name, static_cast<double>(counter.second.realTime_uSec));
+        } else if (counter.second.status == InferenceEngineProfileInfo::OPTIMIZED_OUT) {
+            costs.set(device, name, 0);
+        }
     }
 }
@@ -10,6 +10,7 @@
 #include <ie_ihetero_plugin.hpp>
 #include <utility>
 #include <vector>
+#include "cost_placement.h"
 
 namespace InferenceEngine {
 
@@ -23,8 +24,20 @@ public:
     void setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& pNetwork);
 
 private:
+    void setAffinityByCost(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                           const std::map<std::string, QueryNetworkResult>& queryResults, LayerCosts& costs);
+
+    /**
+     * @brief Loads the network with the layers supported by the device on it and the rest on the other fallback
+     * devices, infers it and takes the execution times of the layers on the device
+     */
+    void profileDevice(const std::map<std::string, std::string>& config, ICNNNetwork& network,
+                       const std::map<std::string, QueryNetworkResult>& queryResults, const std::string& device,
+                       LayerCosts& costs);
+
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::vector<std::string> _fallbackDevices;
+    std::vector<InferenceEngine::IExtensionPtr> _extensions;
     bool _dumpDotFile;
 };
 
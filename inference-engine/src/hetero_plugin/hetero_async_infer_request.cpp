@@ -5,6 +5,8 @@
 
 #include "hetero_async_infer_request.h"
 #include <assert.h>
+#include <chrono>
+#include <memory>
 #include <ie_util_internal.hpp>
 #include <ie_profiling.hpp>
 
@@ -14,9 +16,13 @@ using namespace InferenceEngine;
 HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request,
                                                  const ITaskExecutor::Ptr &taskExecutor,
                                                  const TaskSynchronizer::Ptr &taskSynchronizer,
-                                                 const ITaskExecutor::Ptr &callbackExecutor)
+                                                 const ITaskExecutor::Ptr &callbackExecutor,
+                                                 const HeteroPipeline::Ptr &pipeline)
         : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor),
-          _heteroInferRequest(request) {
+          _heteroInferRequest(request), _pipeline(pipeline) {
+    // Pipeline stages start each other, subgraph requests are not chained by callbacks
+    if (_pipeline) return;
+
     _heteroInferRequest->setCallbackSequence();
 
     std::function<void(InferRequest, StatusCode)> f =
@@ -27,15 +33,137 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
     _heteroInferRequest->setCallbackForLastRequest(f);
 }
 
+HeteroAsyncInferRequest::~HeteroAsyncInferRequest() {
+    // stage tasks and the callback of the last run refer to the request
+    std::unique_lock<std::mutex> lock(_runMutex);
+    _runCondVar.wait(lock, [this]() { return _completedRun >= _startedRun; });
+}
+
+void HeteroAsyncInferRequest::Infer() {
+    if (!_pipeline) {
+        AsyncInferRequestThreadSafeDefault::Infer();
+        return;
+    }
+    _callbackManager.disableCallback();
+    try {
+        StartAsync();
+        Wait(IInferRequest::WaitMode::RESULT_READY);
+    } catch (...) {
+        _callbackManager.enableCallback();
+        throw;
+    }
+    _callbackManager.enableCallback();
+}
+
 void HeteroAsyncInferRequest::StartAsync() {
     IE_PROFILING_AUTO_SCOPE(Hetero_Async)
     if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
     setIsRequestBusy(true);
-    _heteroInferRequest->updateInOutIfNeeded();
-    _heteroInferRequest->startFirstAsyncRequest();
+    if (!_pipeline) {
+        _heteroInferRequest->updateInOutIfNeeded();
+        _heteroInferRequest->startFirstAsyncRequest();
+        return;
+    }
+
+    uint64_t run = 0;
+    try {
+        _heteroInferRequest->updateInOutIfNeeded();
+        _callbackManager.reset();
+        {
+            std::unique_lock<std::mutex> lock(_runMutex);
+            run = ++_startedRun;
+        }
+        _pipeline->submit(0, createStageTask(0, run));
+    } catch (...) {
+        if (run != 0) {
+            std::unique_lock<std::mutex> lock(_runMutex);
+            _completedRun = run;
+            _runException = std::current_exception();
+            _runCondVar.notify_all();
+        }
+        setIsRequestBusy(false);
+        throw;
+    }
+}
+
+Task::Ptr HeteroAsyncInferRequest::createStageTask(size_t stage, uint64_t run) {
+    return std::make_shared<Task>([this, stage, run]() { runStage(stage, run); });
+}
+
+void HeteroAsyncInferRequest::runStage(size_t stage, uint64_t run) {
+    // The request may be completed and destroyed by the next stage as soon as the run is passed to it
+    auto pipeline = _pipeline;
+    bool isLastStage = stage + 1 == pipeline->size();
+
+    auto start = std::chrono::steady_clock::now();
+    std::exception_ptr exception;
+    try {
+        _heteroInferRequest->inferSubRequest(stage);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    auto busyTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    if (!exception && !isLastStage) {
+        try {
+            pipeline->submit(stage + 1, createStageTask(stage + 1, run));
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+    pipeline->stageDone(stage, busyTime);
+    if (exception || isLastStage)
+        completeRun(run, exception);
+}
+
+void HeteroAsyncInferRequest::completeRun(uint64_t run, std::exception_ptr exception) {
+    auto complete = [this, run, exception]() {
+        setIsRequestBusy(false);
+        if (_callbackManager.isCallbackEnabled()) {
+            _callbackManager.set_requestStatus(exception ? GENERAL_ERROR : OK);
+            _callbackManager.set_requestException(exception);
+            try {
+                _callbackManager.runCallback();
+            } catch (...) {}
+        }
+        std::unique_lock<std::mutex> lock(_runMutex);
+        // the callback might have started and even completed the next run
+        if (run > _completedRun) {
+            _completedRun = run;
+            _runException = exception;
+        }
+        _runCondVar.notify_all();
+    };
+
+    if (_callbackManager.isCallbackEnabled() && !_callbackManager.isInline()) {
+        _callbackManager.startTask(std::make_shared<Task>(complete));
+    } else {
+        complete();
+    }
 }
 
 InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
+    if (_pipeline) {
+        if (millis_timeout < IInferRequest::WaitMode::RESULT_READY) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
+                               << IInferRequest::WaitMode::RESULT_READY
+                               << " for InferRequest::Wait\n";
+        }
+        std::unique_lock<std::mutex> lock(_runMutex);
+        if (_startedRun == 0) return INFER_NOT_STARTED;
+        auto run = _startedRun;
+        auto isCompleted = [&]() { return _completedRun >= run; };
+        if (millis_timeout == IInferRequest::WaitMode::STATUS_ONLY) {
+            if (!isCompleted()) return RESULT_NOT_READY;
+        } else if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _runCondVar.wait(lock, isCompleted);
+        } else if (!_runCondVar.wait_for(lock, std::chrono::milliseconds(millis_timeout), isCompleted)) {
+            return RESULT_NOT_READY;
+        }
+        if (_runException) std::rethrow_exception(_runException);
+        return OK;
+    }
+
     auto sts = _heteroInferRequest->waitAllRequests(millis_timeout);
     if (sts != StatusCode::RESULT_NOT_READY && sts != StatusCode::REQUEST_BUSY) {
         setIsRequestBusy(false);
@@ -45,6 +173,7 @@ InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout
 
 void HeteroAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCallback callback) {
     AsyncInferRequestThreadSafeDefault::SetCompletionCallback(callback);
+    if (_pipeline) return;
 
     std::function<void(InferRequest, StatusCode)> f =
             [&](InferRequest /*request*/, StatusCode sts) {
@@ -54,4 +183,4 @@ void HeteroAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCal
             };
 
     _heteroInferRequest->setCallbackForLastRequest(f);
-}
\ No newline at end of file
+}
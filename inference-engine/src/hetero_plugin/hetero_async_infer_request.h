@@ -15,9 +15,12 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "hetero_infer_request.h"
+#include "hetero_pipeline.h"
 
 namespace HeteroPlugin {
 
@@ -28,7 +31,12 @@ public:
     HeteroAsyncInferRequest(HeteroInferRequest::Ptr request,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const HeteroPipeline::Ptr &pipeline = nullptr);
+
+    ~HeteroAsyncInferRequest() override;
+
+    void Infer() override;
 
     void StartAsync() override;
 
@@ -37,7 +45,22 @@ public:
     void SetCompletionCallback(InferenceEngine::IInferRequest::CompletionCallback callback) override;
 
 private:
+    InferenceEngine::Task::Ptr createStageTask(size_t stage, uint64_t run);
+
+    void runStage(size_t stage, uint64_t run);
+
+    void completeRun(uint64_t run, std::exception_ptr exception);
+
     HeteroInferRequest::Ptr _heteroInferRequest;
+
+    // Pipelined execution, if the pipeline is set
+    HeteroPipeline::Ptr _pipeline;
+    std::mutex _runMutex;
+    std::condition_variable _runCondVar;
+    // Runs are numbered by StartAsync, the number of the last completed run and its result
+    uint64_t _startedRun = 0;
+    uint64_t _completedRun = 0;
+    std::exception_ptr _runException;
 };
 
 }  // namespace HeteroPlugin
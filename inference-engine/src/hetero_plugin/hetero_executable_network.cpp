@@ -22,6 +22,7 @@
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "precision_utils.h"
+#include "graph_transformer.h"
 
 using namespace InferenceEngine;
 using namespace HeteroPlugin;
@@ -94,6 +95,12 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     auto networkPtr = cloneNet(network_);
     auto& network = *networkPtr;
 
+    // folded layers are not assigned to devices and never cross subgraphs
+    auto itFoldConstants = config.find(KEY_FOLD_CONSTANTS);
+    if (itFoldConstants == config.end() || itFoldConstants->second != NO) {
+        foldConstants(network);
+    }
+
     // going over all network, if all layers are not assigned to devices, apply the default fallback policy
     details::CNNNetworkIterator i(&network);
     bool allEmpty = true;
@@ -323,6 +330,27 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
 
 
     networks = std::move(descs);
+
+    auto itPipeline = config.find(KEY_HETERO_PIPELINE);
+    if (itPipeline != config.end() && itPipeline->second == YES) {
+        size_t queueSize = 4;
+        auto itQueueSize = config.find(KEY_HETERO_PIPELINE_QUEUE_SIZE);
+        if (itQueueSize != config.end()) {
+            int value = 0;
+            try {
+                value = std::stoi(itQueueSize->second);
+            } catch (...) {}
+            if (value <= 0)
+                THROW_IE_EXCEPTION << "Wrong value " << itQueueSize->second << " for property key "
+                                   << KEY_HETERO_PIPELINE_QUEUE_SIZE << ". Expected only positive numbers";
+            queueSize = static_cast<size_t>(value);
+        }
+
+        std::vector<std::string> devices;
+        for (auto &&network : networks)
+            devices.push_back(network._device);
+        _pipeline = std::make_shared<HeteroPipeline>(devices, queueSize);
+    }
 }
 
 InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
@@ -332,6 +360,7 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     int index = 0;
     for (auto i : networks) {
         HeteroInferRequest::SubRequestDesc desc;
+        desc._device = i._device;
         desc._network = i.network;
         desc._iNames = i._iNames;
         desc._oNames = i._oNames;
@@ -341,7 +370,8 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
-                                                inferRequests);
+                                                inferRequests,
+                                                _pipeline);
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
@@ -349,7 +379,7 @@ void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncReques
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
     auto asyncTreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(
-            heteroInferRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+            heteroInferRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor, _pipeline);
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncTreadSafeImpl),
                        [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
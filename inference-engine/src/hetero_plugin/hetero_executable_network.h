@@ -23,6 +23,7 @@
 #include "hetero_infer_request.h"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.h"
+#include "hetero_pipeline.h"
 
 namespace HeteroPlugin {
 
@@ -70,6 +71,7 @@ private:
         std::unordered_set<std::string> _iNames;
     };
     std::vector<NetworkDesc> networks;
+    HeteroPipeline::Ptr _pipeline;
 
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
 };
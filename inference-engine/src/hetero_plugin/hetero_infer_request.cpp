@@ -16,11 +16,25 @@
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 
+// Bytes in an execution type of the form "<type>: <bytes> bytes"
+static unsigned long long getReportedBytes(const char *execType) {
+    std::string type(execType);
+    auto pos = type.rfind(": ");
+    if (pos == std::string::npos)
+        return 0;
+    try {
+        return std::stoull(type.substr(pos + 2));
+    } catch (...) {
+        return 0;
+    }
+}
+
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
-                                       const SubRequestsList &inferRequests) :
+                                       const SubRequestsList &inferRequests,
+                                       const HeteroPipeline::Ptr &pipeline) :
         InferRequestInternal(networkInputs, networkOutputs),
-        _inferRequests(inferRequests) {
+        _inferRequests(inferRequests), _pipeline(pipeline) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
@@ -64,6 +78,21 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
             requestBlob(e, r._request);
         }
     }
+
+    for (size_t producer = 0; producer < _inferRequests.size(); producer++) {
+        for (auto &&name : _inferRequests[producer]._oNames) {
+            EdgeDesc edge;
+            edge._name = name;
+            edge._producer = producer;
+            edge._byteSize = _blobs[name]->byteSize();
+            for (size_t consumer = 0; consumer < _inferRequests.size(); consumer++) {
+                if (_inferRequests[consumer]._iNames.count(name))
+                    edge._consumers.push_back(consumer);
+            }
+            if (!edge._consumers.empty())
+                _edges.push_back(edge);
+        }
+    }
 }
 
 void HeteroInferRequest::InferImpl() {
@@ -77,19 +106,77 @@ void HeteroInferRequest::InferImpl() {
     }
 }
 
+void HeteroInferRequest::inferSubRequest(size_t index) {
+    auto &desc = _inferRequests[index];
+    IE_PROFILING_AUTO_SCOPE_TASK(desc._profilingTask);
+    desc._request->Infer();
+}
+
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     perfMap.clear();
+    std::vector<std::map<std::string, InferenceEngineProfileInfo>> perfMapRequests;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
-        auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
-        for (auto &&r : perfMapRequest) {
+        perfMapRequests.push_back(_inferRequests[i]._request->GetPerformanceCounts());
+        for (auto &&r : perfMapRequests.back()) {
             perfMap[std::string("subgraph") + std::to_string(i + 1) + ": " + r.first] = r.second;
         }
     }
+
+    // Bytes copied for an edge over all the inferences. A plugin which reports "<copy: name>" counters tells
+    // whether it copied the blob or used it as is. A subgraph whose plugin doesn't report them is taken
+    // as copying the blob each time it produces or consumes it. The execution type of an edge is
+    // "shared: 0 bytes" if none of its ends copied the blob, "copy: <bytes> bytes" otherwise.
+    uint64_t inferCount = _inferCount;
+    for (auto &&edge : _edges) {
+        InferenceEngineProfileInfo info;
+        info.status = InferenceEngineProfileInfo::EXECUTED;
+        info.realTime_uSec = info.cpu_uSec = 0;
+        info.execution_index = static_cast<unsigned>(edge._producer);
+        info.count = inferCount;
+
+        bool shared = true;
+        unsigned long long bytes = 0;
+        std::vector<size_t> ends(1, edge._producer);
+        ends.insert(ends.end(), edge._consumers.begin(), edge._consumers.end());
+        for (auto end : ends) {
+            auto copy = perfMapRequests[end].find("<copy: " + edge._name + ">");
+            if (copy == perfMapRequests[end].end()) {
+                shared = false;
+                bytes += edge._byteSize * inferCount;
+            } else if (copy->second.status == InferenceEngineProfileInfo::EXECUTED) {
+                shared = false;
+                bytes += getReportedBytes(copy->second.exec_type);
+            }
+        }
+        std::string execType = std::string(shared ? "shared" : "copy") + ": " + std::to_string(bytes) + " bytes";
+        execType.copy(info.exec_type, sizeof(info.exec_type) - 1);
+        std::string("HeteroEdge").copy(info.layer_type, sizeof(info.layer_type) - 1);
+        perfMap["<edge " + edge._name + ">"] = info;
+    }
+
+    // Stage entries are shared by all requests of the network: the total busy time of a stage and the time
+    // it was blocked by the next stage
+    if (_pipeline) {
+        auto statistics = _pipeline->getStatistics();
+        for (size_t i = 0; i < statistics.size(); i++) {
+            InferenceEngineProfileInfo info;
+            info.status = InferenceEngineProfileInfo::EXECUTED;
+            info.realTime_uSec = static_cast<long long>(statistics[i].busyTime);
+            info.cpu_uSec = static_cast<long long>(statistics[i].blockedTime);
+            info.execution_index = static_cast<unsigned>(i);
+            info.count = statistics[i].requests;
+            statistics[i].device.copy(info.exec_type, sizeof(info.exec_type) - 1);
+            std::string("PipelineStage").copy(info.layer_type, sizeof(info.layer_type) - 1);
+            perfMap["<pipeline stage " + std::to_string(i + 1) + ">"] = info;
+        }
+    }
 }
 
 void HeteroInferRequest::updateInOutIfNeeded() {
     IE_PROFILING_AUTO_SCOPE(updateInOutIfNeeded);
     assert(!_inferRequests.empty());
+    // called once per inference by all the ways to run the request
+    _inferCount++;
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
         assert(nullptr != r);
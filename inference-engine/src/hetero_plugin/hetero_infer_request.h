@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -20,6 +21,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include "hetero_pipeline.h"
 
 namespace HeteroPlugin {
 
@@ -28,6 +30,7 @@ public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
 
     struct SubRequestDesc {
+        std::string _device;
         InferenceEngine::ExecutableNetwork::Ptr _network;
         InferenceEngine::InferRequest::Ptr _request;
         std::unordered_set<std::string> _iNames;
@@ -38,10 +41,16 @@ public:
 
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
-                                const SubRequestsList &inferRequests);
+                                const SubRequestsList &inferRequests,
+                                const HeteroPipeline::Ptr &pipeline = nullptr);
 
     void InferImpl() override;
 
+    /**
+     * @brief Runs the request of a subgraph synchronously, used by the stages of a pipeline
+     */
+    void inferSubRequest(size_t index);
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
@@ -58,8 +67,24 @@ public:
     bool isAnyRequestBusy();
 
 private:
+    /**
+     * @brief Data passed from a subgraph to the following ones. All the subgraphs of an edge share one blob, so
+     * an edge is not copied unless a plugin can't use the blob as its own memory
+     */
+    struct EdgeDesc {
+        std::string _name;
+        // Indices of the producer and the consumers in _inferRequests
+        size_t _producer;
+        std::vector<size_t> _consumers;
+        size_t _byteSize;
+    };
+
     SubRequestsList _inferRequests;
+    std::vector<EdgeDesc> _edges;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+    HeteroPipeline::Ptr _pipeline;
+    // Read by GetPerformanceCounts while an inference may be running
+    std::atomic<uint64_t> _inferCount{0};
 };
 
 }  // namespace HeteroPlugin
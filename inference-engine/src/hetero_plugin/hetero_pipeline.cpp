@@ -0,0 +1,73 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <details/ie_exception.hpp>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const std::vector<std::string> &devices, size_t queueSize)
+        : _queueSize(queueSize), _created(std::chrono::steady_clock::now()) {
+    for (size_t i = 0; i < devices.size(); i++) {
+        std::unique_ptr<Stage> stage(new Stage);
+        stage->device = devices[i];
+        // Aging is off: requests have to leave a stage in the order they came to it
+        stage->executor = std::make_shared<PriorityTaskExecutor>("HeteroStage" + std::to_string(i), 1, 0);
+        _stages.push_back(std::move(stage));
+    }
+}
+
+size_t HeteroPipeline::size() const {
+    return _stages.size();
+}
+
+void HeteroPipeline::submit(size_t stage, Task::Ptr task) {
+    if (stage >= _stages.size()) THROW_IE_EXCEPTION << "Hetero pipeline has no stage " << stage;
+    auto &s = *_stages[stage];
+    {
+        std::unique_lock<std::mutex> lock(s.mutex);
+        if (stage > 0 && s.occupied > _queueSize) {
+            auto start = std::chrono::steady_clock::now();
+            s.roomCondVar.wait(lock, [&]() { return s.occupied <= _queueSize; });
+            _stages[stage - 1]->blockedTime += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+        }
+        s.occupied++;
+    }
+    if (!s.executor->startTask(task)) {
+        stageDone(stage, std::chrono::microseconds(0));
+        THROW_IE_EXCEPTION << "Failed to start a task of hetero pipeline stage " << stage;
+    }
+}
+
+void HeteroPipeline::stageDone(size_t stage, std::chrono::microseconds busyTime) {
+    auto &s = *_stages[stage];
+    s.requests++;
+    s.busyTime += busyTime.count();
+    std::unique_lock<std::mutex> lock(s.mutex);
+    s.occupied--;
+    s.roomCondVar.notify_one();
+}
+
+std::vector<PipelineStageStatistics> HeteroPipeline::getStatistics() {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - _created).count();
+    std::vector<PipelineStageStatistics> statistics;
+    for (auto &stage : _stages) {
+        PipelineStageStatistics s;
+        s.device = stage->device;
+        s.requests = stage->requests;
+        s.busyTime = stage->busyTime;
+        s.blockedTime = stage->blockedTime;
+        s.occupancy = elapsed > 0 ? static_cast<double>(s.busyTime) / elapsed : 0;
+        s.queue = stage->executor->getStatistics();
+        statistics.push_back(s);
+    }
+    return statistics;
+}
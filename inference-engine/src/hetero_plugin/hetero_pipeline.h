@@ -0,0 +1,90 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for pipelined execution of hetero subgraphs
+ * @file hetero_pipeline.h
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cpp_interfaces/ie_task.hpp>
+#include <cpp_interfaces/ie_priority_task_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Statistics of a pipeline stage, times are in microseconds
+ */
+struct PipelineStageStatistics {
+    std::string device;
+    // Requests executed by the stage
+    uint64_t requests = 0;
+    // Time the stage was executing requests
+    uint64_t busyTime = 0;
+    // Time the stage waited for room in the queue of the next stage
+    uint64_t blockedTime = 0;
+    // Part of the time since the pipeline creation the stage was busy
+    double occupancy = 0;
+    InferenceEngine::TaskExecutorStatistics queue;
+};
+
+/**
+ * @class HeteroPipeline
+ * @brief Executes subgraphs of hetero requests as stages of a pipeline. Each stage has its own worker, so stage k
+ * of a request runs while stage k+1 of the previous request does. The queues of all the stages except the first one
+ * are bounded: a stage which can't pass a request to the next stage waits until there is room for it.
+ */
+class HeteroPipeline {
+public:
+    typedef std::shared_ptr<HeteroPipeline> Ptr;
+
+    /**
+     * @param devices Devices of the stages
+     * @param queueSize Maximum number of requests waiting for a stage, except the first one
+     */
+    HeteroPipeline(const std::vector<std::string> &devices, size_t queueSize);
+
+    size_t size() const;
+
+    /**
+     * @brief Queues the task to the stage. Blocks while the queue of the stage is full
+     */
+    void submit(size_t stage, InferenceEngine::Task::Ptr task);
+
+    /**
+     * @brief Makes room in the queue of the stage, should be called by a task of the stage when it is done
+     * @param busyTime Time the task has been executed for
+     */
+    void stageDone(size_t stage, std::chrono::microseconds busyTime);
+
+    std::vector<PipelineStageStatistics> getStatistics();
+
+private:
+    struct Stage {
+        std::string device;
+        InferenceEngine::PriorityTaskExecutor::Ptr executor;
+        std::mutex mutex;
+        std::condition_variable roomCondVar;
+        // Requests queued to the stage or running on it
+        size_t occupied = 0;
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> busyTime{0};
+        std::atomic<uint64_t> blockedTime{0};
+    };
+
+    std::vector<std::unique_ptr<Stage>> _stages;
+    size_t _queueSize;
+    std::chrono::steady_clock::time_point _created;
+};
+
+}  // namespace HeteroPlugin
@@ -34,6 +34,7 @@ void Engine::GetVersion(const Version *&versionInfo)noexcept {
 Engine::Engine() {
     _config[InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS] = "YES";
     _config[KEY_HETERO_DUMP_GRAPH_DOT] = NO;
+    _config[KEY_HETERO_PIPELINE] = NO;
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
@@ -47,6 +48,10 @@ InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(Infer
             tconfig[c.first] = c.second;
         }
     }
+    // stages of a pipeline have to run in parallel even if they are on the same device
+    if (tconfig[KEY_HETERO_PIPELINE] == YES && config.find(KEY_EXCLUSIVE_ASYNC_REQUESTS) == config.end()) {
+        tconfig[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+    }
     return std::make_shared<HeteroExecutableNetwork>(network, tconfig, _extensions, _deviceLoaders);
 }
 
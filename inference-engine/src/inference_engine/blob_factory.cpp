@@ -16,6 +16,11 @@ InferenceEngine::Blob::Ptr make_blob_with_precision(const InferenceEngine::Tenso
     return make_blob_with_precision(desc.getPrecision(), desc, ptr);
 }
 
+InferenceEngine::Blob::Ptr make_blob_with_precision(const InferenceEngine::TensorDesc& desc,
+                                                    const std::shared_ptr<InferenceEngine::IAllocator>& alloc) {
+    return make_blob_with_precision(desc.getPrecision(), desc, alloc);
+}
+
 InferenceEngine::Blob::Ptr CreateBlobFromData(const InferenceEngine::DataPtr &data) {
     // TODO Here some decision should be made about the layout.
     // For now we just pass the layout and use conversion to NCHW for ANY.
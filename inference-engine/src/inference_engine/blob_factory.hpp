@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include "inference_engine.hpp"
 
@@ -24,6 +25,10 @@ class BlobFactory {
     static InferenceEngine::Blob::Ptr make(const InferenceEngine::TensorDesc& desc, void* ptr) {
         return InferenceEngine::make_shared_blob<BlobType>(desc, reinterpret_cast<BlobType*>(ptr));
     }
+    static InferenceEngine::Blob::Ptr make(const InferenceEngine::TensorDesc& desc,
+                                           const std::shared_ptr<InferenceEngine::IAllocator>& alloc) {
+        return InferenceEngine::make_shared_blob<BlobType>(desc, alloc);
+    }
 };
 
 template <InferenceEngine::Precision::ePrecision precision, class ... Args> InferenceEngine::Blob::Ptr make_shared_blob2(Args && ... args) {
@@ -36,6 +41,8 @@ template <InferenceEngine::Precision::ePrecision precision, class ... Args> Infe
 
 INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc);
 INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc, void* ptr);
+INFERENCE_ENGINE_API_CPP(InferenceEngine::Blob::Ptr) make_blob_with_precision(const InferenceEngine::TensorDesc& desc,
+                                                                                const std::shared_ptr<InferenceEngine::IAllocator>& alloc);
 
 template <class ... Args>
 InferenceEngine::Blob::Ptr make_blob_with_precision(InferenceEngine::Precision precision, Args &&... args) {
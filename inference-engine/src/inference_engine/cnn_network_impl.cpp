@@ -34,6 +34,14 @@ void CNNNetworkImpl::addLayer(const CNNLayerPtr& layer) noexcept {
     _layers[layer->name] = layer;
 }
 
+void CNNNetworkImpl::removeLayer(const std::string& layerName) {
+    _layers.erase(layerName);
+}
+
+void CNNNetworkImpl::removeData(const std::string& dataName) {
+    _data.erase(dataName);
+}
+
 void CNNNetworkImpl::validate(int version) {
     if (version != 1) {
         std::set<std::string> layerNames;
@@ -78,6 +78,11 @@ public:
 
     void addLayer(const CNNLayerPtr& layer) noexcept override;
 
+    // Both only drop the objects from the maps of the network, connections are up to the caller
+    void removeLayer(const std::string& layerName);
+
+    void removeData(const std::string& dataName);
+
     StatusCode getLayerByName(const char* layerName, CNNLayerPtr& out, ResponseDesc* resp) const noexcept override;
 
     // deprecated, as there is no ResponseDesc to put error message
@@ -59,6 +59,10 @@ public:
         TO_STATUS(_impl->GetMappedTopology(deployedTopology));
     }
 
+    StatusCode GetMemoryInfo(MemoryInfo &info, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->GetMemoryInfo(info));
+    }
+
     StatusCode  QueryState(IMemoryState::Ptr & pState, size_t idx
         , ResponseDesc *resp) noexcept override {
         try {
@@ -38,6 +38,10 @@ public:
         TO_STATUS(_impl->GetPerformanceCounts(perfMap));
     }
 
+    StatusCode ResetPerformanceCounts(ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->ResetPerformanceCounts());
+    }
+
     StatusCode SetBlob(const char *name, const Blob::Ptr &data, ResponseDesc *resp) noexcept override {
         TO_STATUS(_impl->SetBlob(name, data));
     }
@@ -76,6 +80,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetConfig(const std::map<std::string, std::string> &config, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetConfig(config));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
@@ -3,23 +3,33 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <map>
 #include <memory>
 #include <string>
 #include "cpp_interfaces/ie_executor_manager.hpp"
-#include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_priority_task_executor.hpp"
 
 namespace InferenceEngine {
 
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
-        auto newExec = std::make_shared<TaskExecutor>(id);
+        auto newExec = std::make_shared<PriorityTaskExecutor>(id);
         executors[id] = newExec;
         return newExec;
     }
     return foundEntry->second;
 }
 
+std::map<std::string, TaskExecutorStatistics> ExecutorManagerImpl::getStatistics() {
+    std::map<std::string, TaskExecutorStatistics> statistics;
+    for (auto &entry : executors) {
+        if (auto executor = std::dynamic_pointer_cast<PriorityTaskExecutor>(entry.second))
+            statistics[entry.first] = executor->getStatistics();
+    }
+    return statistics;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -35,6 +45,10 @@ ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
     return _impl.getExecutor(id);
 }
 
+std::map<std::string, TaskExecutorStatistics> ExecutorManager::getStatistics() {
+    return _impl.getStatistics();
+}
+
 size_t ExecutorManager::getExecutorsNumber() {
     return _impl.getExecutorsNumber();
 }
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <unordered_map>
 #include "ie_api.h"
 #include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_priority_task_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -22,6 +24,8 @@ class ExecutorManagerImpl {
 public:
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    std::map<std::string, TaskExecutorStatistics> getStatistics();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -58,6 +62,11 @@ public:
      */
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Returns queue statistics of the executors by their identificators, e.g. for monitoring
+     */
+    std::map<std::string, TaskExecutorStatistics> getStatistics();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
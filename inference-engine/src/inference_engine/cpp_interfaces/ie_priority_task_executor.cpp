@@ -0,0 +1,118 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include "ie_tracer.hpp"
+#include "details/ie_exception.hpp"
+#include "ie_task.hpp"
+#include "ie_priority_task_executor.hpp"
+
+namespace InferenceEngine {
+
+PriorityTaskExecutor::PriorityTaskExecutor(std::string name, size_t workers, int64_t agingMicros)
+        : _runningTasks(0), _sequence(0), _isStopped(false), _name(name), _aging(agingMicros) {
+    if (workers == 0) THROW_IE_EXCEPTION << "PriorityTaskExecutor requires at least one worker";
+    for (size_t i = 0; i < workers; i++)
+        _threads.emplace_back([this] { run(); });
+}
+
+PriorityTaskExecutor::~PriorityTaskExecutor() {
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        _idleCondVar.wait(lock, [this]() { return _taskQueue.empty() && _runningTasks == 0; });
+        _isStopped = true;
+        _queueCondVar.notify_all();
+    }
+    for (auto &thread : _threads) {
+        if (thread.joinable()) thread.join();
+    }
+}
+
+std::vector<PriorityTaskExecutor::QueuedTask>::iterator
+PriorityTaskExecutor::selectNext(std::chrono::steady_clock::time_point now) {
+    auto effectivePriority = [&](const QueuedTask &queued) -> int64_t {
+        int64_t promotions = _aging.count() > 0 ? (now - queued.queuedAt) / _aging : 0;
+        return queued.priority + promotions;
+    };
+
+    auto next = _taskQueue.begin();
+    int64_t nextPriority = effectivePriority(*next);
+    for (auto it = std::next(next); it != _taskQueue.end(); it++) {
+        int64_t priority = effectivePriority(*it);
+        if (priority != nextPriority) {
+            if (priority < nextPriority) continue;
+        } else if (it->deadline != next->deadline) {
+            if (it->deadline > next->deadline) continue;
+        } else if (it->sequence > next->sequence) {
+            continue;
+        }
+        next = it;
+        nextPriority = priority;
+    }
+    return next;
+}
+
+void PriorityTaskExecutor::run() {
+    while (true) {
+        QueuedTask current;
+        {  // waiting for the new task or for stop signal
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
+            if (_taskQueue.empty())
+                break;
+
+            auto now = std::chrono::steady_clock::now();
+            auto next = selectNext(now);
+            current = *next;
+            _taskQueue.erase(next);
+            _runningTasks++;
+
+            auto waitTime = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(now - current.queuedAt).count());
+            _statistics.tasksStarted++;
+            _statistics.totalWaitTime += waitTime;
+            _statistics.maxWaitTime = std::max(_statistics.maxWaitTime, waitTime);
+            if (current.tracedAt != 0)
+                Tracing::RecordAsync(_name.c_str(), "queue", nullptr, current.tracedAt, Tracing::Now());
+        }
+
+        current.task->runNoThrowNoBusyCheck();
+
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        if (std::chrono::steady_clock::now() > current.deadline)
+            _statistics.deadlinesMissed++;
+        _runningTasks--;
+        if (_taskQueue.empty() && _runningTasks == 0) {
+            // notify dtor, that all tasks were completed
+            _idleCondVar.notify_all();
+        }
+    }
+}
+
+bool PriorityTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _taskQueue.push_back({task, task->getPriority(), task->getDeadline(), std::chrono::steady_clock::now(),
+                          _sequence++, Tracing::IsActive() ? Tracing::Now() : 0});
+    _statistics.maxQueueDepth = std::max(_statistics.maxQueueDepth, _taskQueue.size());
+    _queueCondVar.notify_one();
+    return true;
+}
+
+TaskExecutorStatistics PriorityTaskExecutor::getStatistics() {
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    TaskExecutorStatistics statistics = _statistics;
+    statistics.queueDepth = _taskQueue.size();
+    return statistics;
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,97 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include "ie_api.h"
+#include "details/ie_exception.hpp"
+#include "cpp_interfaces/ie_task.hpp"
+#include "cpp_interfaces/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Queue statistics of a task executor, times are in microseconds
+ */
+struct TaskExecutorStatistics {
+    // Tasks waiting in the queue now
+    size_t queueDepth = 0;
+    size_t maxQueueDepth = 0;
+    // Tasks started by the workers
+    uint64_t tasksStarted = 0;
+    // Tasks which were completed after their deadlines
+    uint64_t deadlinesMissed = 0;
+    // Time between the queuing and the start of the tasks
+    uint64_t totalWaitTime = 0;
+    uint64_t maxWaitTime = 0;
+};
+
+/**
+ * @class PriorityTaskExecutor
+ * @brief Executor which starts queued tasks in order of their priority classes (Task::setPriority) and, within a class,
+ * in order of their deadlines (Task::setDeadline). Tasks without deadlines and with equal deadlines are started
+ * in FIFO order. Waiting tasks are promoted to the next priority class each aging interval, so tasks of the low
+ * priority classes are not starved by a steady flow of high priority tasks.
+ * With one worker and tasks of default priority it works as TaskExecutor.
+ */
+class INFERENCE_ENGINE_API_CLASS(PriorityTaskExecutor) : public ITaskExecutor {
+public:
+    typedef std::shared_ptr<PriorityTaskExecutor> Ptr;
+
+    /**
+     * @param name Name of the executor for tracing
+     * @param workers Number of threads which execute the tasks
+     * @param agingMicros Time a task waits before it is promoted to the next priority class, 0 to disable aging
+     */
+    explicit PriorityTaskExecutor(std::string name = "Default", size_t workers = 1, int64_t agingMicros = 100000);
+
+    ~PriorityTaskExecutor();
+
+    /**
+     * @brief Adds the task to the queue and notifies one of the workers about it
+     * @note can be called from multiple threads
+     * @param task - shared pointer to the task to start
+     *  @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(Task::Ptr task) override;
+
+    TaskExecutorStatistics getStatistics();
+
+private:
+    struct QueuedTask {
+        Task::Ptr task;
+        int priority;
+        std::chrono::steady_clock::time_point deadline;
+        std::chrono::steady_clock::time_point queuedAt;
+        uint64_t sequence;
+        // Non zero if tracing was enabled when the task was queued
+        uint64_t tracedAt;
+    };
+
+    void run();
+
+    std::vector<QueuedTask>::iterator selectNext(std::chrono::steady_clock::time_point now);
+
+    std::vector<std::thread> _threads;
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondVar;
+    std::condition_variable _idleCondVar;
+    std::vector<QueuedTask> _taskQueue;
+    size_t _runningTasks;
+    uint64_t _sequence;
+    bool _isStopped;
+    std::string _name;
+    std::chrono::microseconds _aging;
+    TaskExecutorStatistics _statistics;
+};
+
+}  // namespace InferenceEngine
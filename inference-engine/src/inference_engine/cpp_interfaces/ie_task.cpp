@@ -9,6 +9,8 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <chrono>
+#include <algorithm>
 #include <ie_profiling.hpp>
 #include "details/ie_exception.hpp"
 #include "exception2status.hpp"
@@ -45,8 +47,12 @@ Task::Status Task::runNoThrowNoBusyCheck() noexcept {
 
 Task::Status Task::runWithSynchronizer(TaskSynchronizer::Ptr &taskSynchronizer) {
     if (occupy()) {
-        ScopedSynchronizer scopedSynchronizer(taskSynchronizer);
-        runNoThrowNoBusyCheck();
+        if (!taskSynchronizer) {
+            runNoThrowNoBusyCheck();
+        } else {
+            ScopedSynchronizer scopedSynchronizer(taskSynchronizer);
+            runNoThrowNoBusyCheck();
+        }
     }
     return getStatus();
 }
@@ -72,6 +78,29 @@ Task::Status Task::wait(int64_t millis_timeout) {
     return _status;
 }
 
+Task::Status Task::spinWait(int64_t millis_timeout, int64_t spin_micros) {
+    auto start = std::chrono::steady_clock::now();
+    auto spin = std::chrono::microseconds(spin_micros);
+    if (millis_timeout >= 0)
+        spin = std::min<std::chrono::microseconds>(spin, std::chrono::milliseconds(millis_timeout));
+
+    _isOnWait = true;
+    while (std::chrono::steady_clock::now() - start < spin) {
+        Status status = getStatus();
+        if (status == TS_DONE || status == TS_ERROR || status == TS_INITIAL) {
+            _isOnWait = false;
+            return status;
+        }
+        std::this_thread::yield();
+    }
+
+    if (millis_timeout >= 0) {
+        auto spent = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        millis_timeout = std::max<int64_t>(0, millis_timeout - spent.count());
+    }
+    return wait(millis_timeout);
+}
+
 bool Task::occupy() {
     std::unique_lock<std::mutex> guard(_taskStatusMutex);
     if (_status == Task::TS_BUSY) return false;
@@ -115,4 +144,20 @@ bool Task::isOnWait() {
     return _isOnWait;
 }
 
+void Task::setPriority(int priority) {
+    _priority = priority;
+}
+
+int Task::getPriority() const {
+    return _priority;
+}
+
+void Task::setDeadline(std::chrono::steady_clock::time_point deadline) {
+    _deadline = deadline;
+}
+
+std::chrono::steady_clock::time_point Task::getDeadline() const {
+    return _deadline;
+}
+
 }  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <chrono>
 #include "ie_api.h"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/exception2status.hpp"
@@ -55,7 +56,8 @@ public:
     /**
      * @brief Executes the task in turn, controlled by task synchronizer
      *  @note Can be called from multiple threads - will return TS_BUSY(1) status for the task which is currently running
-     * @param taskSynchronizer - shared pointer to the task synchronizer, which ensures thread-safe execution multiple tasks from multiple threads
+     * @param taskSynchronizer - shared pointer to the task synchronizer, which ensures thread-safe execution multiple tasks from multiple threads,
+     *  nullptr to run the task without synchronization
      * @return Enumeration of the task status: TS_DONE(2) for success
      */
     Status runWithSynchronizer(TaskSynchronizer::Ptr &taskSynchronizer);
@@ -68,6 +70,15 @@ public:
      */
     Status wait(int64_t millis_timeout);
 
+    /**
+     * @brief Polls the task status for up to spin_micros microseconds, then waits like wait(millis_timeout).
+     * Saves the thread wake-up for a task which is about to finish at the cost of a busy core.
+     * @param millis_timeout Maximum duration in milliseconds to wait for, including the polling
+     * @param spin_micros Maximum duration of the polling in microseconds
+     * @return Enumeration of the task status: TS_DONE(2) for success
+     */
+    Status spinWait(int64_t millis_timeout, int64_t spin_micros);
+
     /**
      * @brief Occupies task for launching. Makes busy status, if task is not running
      * @return true if occupation succeed, otherwise - false
@@ -82,6 +93,23 @@ public:
 
     bool isOnWait();
 
+    /**
+     * @brief Sets the priority class of the task for executors which order their queues (see PriorityTaskExecutor)
+     * @param priority Tasks of a higher priority are started first, 0 by default
+     */
+    void setPriority(int priority);
+
+    int getPriority() const;
+
+    /**
+     * @brief Sets the time the task should be completed by. Executors which order their queues start tasks of the same
+     * priority class in order of their deadlines
+     * @param deadline Time point of the deadline, time_point::max() (default) for no deadline
+     */
+    void setDeadline(std::chrono::steady_clock::time_point deadline);
+
+    std::chrono::steady_clock::time_point getDeadline() const;
+
 protected:
     void setStatus(Status status);
 
@@ -93,6 +121,8 @@ protected:
     std::condition_variable _isTaskDoneCondVar;
 
     bool _isOnWait = false;
+    int _priority = 0;
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
 };
 
 }  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include <thread>
 #include <queue>
 #include <ie_profiling.hpp>
+#include "ie_tracer.hpp"
 #include "details/ie_exception.hpp"
 #include "ie_task.hpp"
 #include "ie_task_executor.hpp"
@@ -26,7 +27,11 @@ TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
                 std::unique_lock<std::mutex> lock(_queueMutex);
                 _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
                 isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
+                if (!isQueueEmpty) {
+                    currentTask = _taskQueue.front().task;
+                    if (_taskQueue.front().queuedAt != 0)
+                        Tracing::RecordAsync(_name.c_str(), "queue", nullptr, _taskQueue.front().queuedAt, Tracing::Now());
+                }
             }
             if (_isStopped && isQueueEmpty)
                 break;
@@ -62,7 +67,7 @@ TaskExecutor::~TaskExecutor() {
 bool TaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
+    _taskQueue.push({task, Tracing::IsActive() ? Tracing::Now() : 0});
     _queueCondVar.notify_all();
     return true;
 }
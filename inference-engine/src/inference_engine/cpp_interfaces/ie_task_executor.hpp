@@ -38,10 +38,16 @@ public:
     bool startTask(Task::Ptr task) override;
 
 private:
+    struct QueuedTask {
+        Task::Ptr task;
+        // Non zero if tracing was enabled when the task was queued
+        uint64_t queuedAt;
+    };
+
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    std::queue<QueuedTask> _taskQueue;
     bool _isStopped;
     std::string _name;
 };
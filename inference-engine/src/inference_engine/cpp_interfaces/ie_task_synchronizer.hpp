@@ -12,6 +12,7 @@
 #include <thread>
 #include <queue>
 #include "details/ie_exception.hpp"
+#include "ie_tracer.hpp"
 
 namespace InferenceEngine {
 
@@ -24,6 +25,7 @@ public:
     TaskSynchronizer() : _taskCount(0) {}
 
     virtual void lock() {
+        IE_TRACE_SCOPE("TaskSynchronizer::wait", "wait")
         auto taskID = _addTaskToQueue();
         _waitInQueue(taskID);
     }
@@ -60,6 +60,10 @@ public:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    void GetMemoryInfo(MemoryInfo &info) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     void SetPointerToPluginInternal(InferencePluginInternalPtr plugin) {
         _plugin = plugin;
     }
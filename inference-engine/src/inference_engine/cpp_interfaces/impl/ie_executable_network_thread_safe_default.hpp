@@ -14,6 +14,7 @@
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_priority_task_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -24,7 +25,7 @@ public:
 
     ExecutableNetworkThreadSafeDefault() {
         _taskSynchronizer = std::make_shared<TaskSynchronizer>();
-        _taskExecutor = std::make_shared<TaskExecutor>();
+        _taskExecutor = std::make_shared<PriorityTaskExecutor>();
         _callbackExecutor = std::make_shared<TaskExecutor>();
     }
 
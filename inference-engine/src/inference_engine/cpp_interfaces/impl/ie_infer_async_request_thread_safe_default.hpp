@@ -11,11 +11,14 @@
 #include <string>
 #include <mutex>
 #include <exception>
+#include <chrono>
+#include <ie_plugin_config.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/ie_task_with_stages.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include "ie_infer_async_request_thread_safe_internal.hpp"
+#include "ie_tracer.hpp"
 
 namespace InferenceEngine {
 
@@ -47,6 +50,9 @@ public:
 
     void startTask(Task::Ptr task) { _callbackExecutor->startTask(task); }
 
+    // Without an executor callbacks are run by the thread which has finished the request
+    bool isInline() const { return _callbackExecutor == nullptr; }
+
     void reset() {
         _requestException = nullptr;
         _requestStatus = OK;
@@ -58,7 +64,10 @@ public:
             if (!requestPtr) {
                 THROW_IE_EXCEPTION << "Failed to run callback: can't get pointer to request";
             }
-            _callback(requestPtr, _requestStatus);
+            {
+                IE_TRACE_SCOPE("Callback", "callback")
+                _callback(requestPtr, _requestStatus);
+            }
             if (_requestException) std::rethrow_exception(_requestException);
         }
     }
@@ -85,6 +94,14 @@ class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInt
 public:
     typedef std::shared_ptr<AsyncInferRequestThreadSafeDefault> Ptr;
 
+    /**
+     * @param request Synchronous request to run
+     * @param taskExecutor Executor of the asynchronous requests
+     * @param taskSynchronizer Serializes synchronous Infer calls with other requests, nullptr if the request
+     * doesn't share its resources with other requests
+     * @param callbackExecutor Executor of completion callbacks, nullptr to run them right after the request
+     * by the thread of taskExecutor
+     */
     explicit AsyncInferRequestThreadSafeDefault(InferRequestInternal::Ptr request,
                                                 const ITaskExecutor::Ptr &taskExecutor,
                                                 const TaskSynchronizer::Ptr &taskSynchronizer,
@@ -149,6 +166,10 @@ public:
         _syncRequest->checkBlobs();
         _callbackManager.reset();
         initNextAsyncTask();
+        _currentTask->setPriority(_priority);
+        _currentTask->setDeadline(_deadlineMicros > 0
+                                  ? std::chrono::steady_clock::now() + std::chrono::microseconds(_deadlineMicros)
+                                  : std::chrono::steady_clock::time_point::max());
         startAsyncTask();
     }
 
@@ -161,7 +182,10 @@ public:
             while (asyncTask->getStage() != 1) asyncTask->stageDone();
             _callbackManager.set_requestStatus(GENERAL_ERROR);
             _callbackManager.set_requestException(requestException);
-            _callbackManager.startTask(asyncTask);
+            if (_callbackManager.isInline())
+                runCallbackStage(asyncTask);
+            else
+                _callbackManager.startTask(asyncTask);
         } else {
             std::rethrow_exception(requestException);
         }
@@ -175,17 +199,17 @@ public:
                     case 2: {
                         _syncRequest->Infer();
                         asyncTaskCopy->stageDone();
-                        if (_callbackManager.isCallbackEnabled()) {
-                            _callbackManager.startTask(asyncTaskCopy);
-                        } else {
+                        if (!_callbackManager.isCallbackEnabled()) {
                             asyncTaskCopy->stageDone();
+                        } else if (_callbackManager.isInline()) {
+                            runCallbackStage(asyncTaskCopy);
+                        } else {
+                            _callbackManager.startTask(asyncTaskCopy);
                         }
                     }
                         break;
                     case 1: {
-                        setIsRequestBusy(false);
-                        asyncTaskCopy->stageDone();
-                        _callbackManager.runCallback();
+                        runCallbackStage(asyncTaskCopy);
                     }
                         break;
                     default:
@@ -197,6 +221,19 @@ public:
         }, 2);
     }
 
+    void runCallbackStage(StagedTask::Ptr asyncTask) {
+        setIsRequestBusy(false);
+        asyncTask->stageDone();
+        _callbackManager.runCallback();
+    }
+
+    /**
+     * @brief Makes Wait poll the request status for up to spinMicros microseconds before blocking
+     */
+    void SetSpinWait(int64_t spinMicros) {
+        _spinWaitMicros = spinMicros;
+    }
+
     StatusCode Wait(int64_t millis_timeout) override {
         auto taskCopy = _currentTask;
         if (millis_timeout < IInferRequest::WaitMode::RESULT_READY) {
@@ -208,7 +245,8 @@ public:
         if (millis_timeout == IInferRequest::WaitMode::STATUS_ONLY) {
             status = taskCopy->getStatus();
         } else {
-            status = taskCopy->wait(millis_timeout);
+            status = _spinWaitMicros > 0 ? taskCopy->spinWait(millis_timeout, _spinWaitMicros)
+                                         : taskCopy->wait(millis_timeout);
             setIsRequestBusy(false);
         }
 
@@ -228,6 +266,10 @@ public:
         _syncRequest->GetPerformanceCounts(perfMap);
     }
 
+    void ResetPerformanceCounts_ThreadUnsafe() override {
+        _syncRequest->ResetPerformanceCounts();
+    }
+
     void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) override {
         _syncRequest->SetBlob(name, data);
     }
@@ -257,6 +299,39 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetConfig_ThreadUnsafe(const std::map<std::string, std::string> &config) override {
+        // Scheduling properties are handled here, the rest is up to the plugin request
+        std::map<std::string, std::string> requestConfig;
+        for (auto &entry : config) {
+            const std::string &key = entry.first;
+            const std::string &val = entry.second;
+            if (key == PluginConfigParams::KEY_REQUEST_PRIORITY) {
+                if (val == PluginConfigParams::REQUEST_PRIORITY_LOW) _priority = -1;
+                else if (val == PluginConfigParams::REQUEST_PRIORITY_NORMAL) _priority = 0;
+                else if (val == PluginConfigParams::REQUEST_PRIORITY_HIGH) _priority = 1;
+                else
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_REQUEST_PRIORITY
+                                       << ". Expected only " << PluginConfigParams::REQUEST_PRIORITY_LOW << "/"
+                                       << PluginConfigParams::REQUEST_PRIORITY_NORMAL << "/"
+                                       << PluginConfigParams::REQUEST_PRIORITY_HIGH;
+            } else if (key == PluginConfigParams::KEY_REQUEST_DEADLINE) {
+                int64_t deadline = -1;
+                try {
+                    deadline = std::stoll(val);
+                } catch (...) {}
+                if (deadline < 0)
+                    THROW_IE_EXCEPTION << "Wrong value " << val << " for property key "
+                                       << PluginConfigParams::KEY_REQUEST_DEADLINE
+                                       << ". Expected only non-negative numbers of microseconds";
+                _deadlineMicros = deadline;
+            } else {
+                requestConfig.insert(entry);
+            }
+        }
+        if (!requestConfig.empty())
+            _syncRequest->SetConfig(requestConfig);
+    }
+
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
@@ -267,6 +342,9 @@ protected:
     std::list<StagedTask::Ptr> _listAsyncTasks;
     void *_userData;
     CallbackManager _callbackManager;
+    int64_t _spinWaitMicros = 0;
+    int _priority = 0;
+    int64_t _deadlineMicros = 0;
 };
 
 }  // namespace InferenceEngine
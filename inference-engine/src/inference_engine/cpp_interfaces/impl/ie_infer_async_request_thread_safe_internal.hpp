@@ -78,10 +78,15 @@ public:
     }
 
     void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override {
-        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        // Allowed for a busy request, counters have to be safe to read during inference
         GetPerformanceCounts_ThreadUnsafe(perfMap);
     }
 
+    void ResetPerformanceCounts() override {
+        // Allowed for a busy request, counters have to be safe to reset during inference
+        ResetPerformanceCounts_ThreadUnsafe();
+    }
+
     void SetBlob(const char *name, const Blob::Ptr &data) override {
         if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         SetBlob_ThreadUnsafe(name, data);
@@ -97,6 +102,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetConfig(const std::map<std::string, std::string> &config) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetConfig_ThreadUnsafe(config);
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -114,11 +124,15 @@ public:
     virtual void
     GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const = 0;
 
+    virtual void ResetPerformanceCounts_ThreadUnsafe() = 0;
+
     virtual void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) = 0;
 
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetConfig_ThreadUnsafe(const std::map<std::string, std::string> &config) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -169,6 +169,15 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    void SetConfig(const std::map<std::string, std::string> &config) override {
+        for (auto &entry : config)
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << entry.first << " of infer request";
+    }
+
+    void ResetPerformanceCounts() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
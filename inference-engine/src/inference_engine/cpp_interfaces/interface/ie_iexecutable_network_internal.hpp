@@ -11,6 +11,7 @@
 #include <string>
 #include <ie_iinfer_request.hpp>
 #include <ie_primitive_info.hpp>
+#include <ie_memory_info.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 
 namespace InferenceEngine {
@@ -61,6 +62,12 @@ public:
      */
     virtual void GetMappedTopology(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &deployedTopology) = 0;
 
+    /**
+     * @brief Get the host memory footprint of the executable network
+     * @param info - memory info to fill
+     */
+    virtual void GetMemoryInfo(MemoryInfo &info) = 0;
+
 
     virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
 };
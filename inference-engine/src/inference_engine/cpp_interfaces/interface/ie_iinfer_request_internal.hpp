@@ -35,6 +35,11 @@ public:
      */
     virtual void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const = 0;
 
+    /**
+     * @brief Resets performance counters of the request
+     */
+    virtual void ResetPerformanceCounts() = 0;
+
     /**
      * @brief Set input/output data to infer
      * @note: Memory allocation doesn't happen
@@ -56,6 +61,12 @@ public:
     * @param batch - new batch size to be used by all the following inference calls for this request.
     */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+    * @brief Sets properties of the request
+    * @param config - map of pairs: (property name, property value)
+    */
+    virtual void SetConfig(const std::map<std::string, std::string> &config) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -4,7 +4,17 @@
 //
 
 #include <assert.h>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include "graph_transformer.h"
+#include "caseless.hpp"
+#include "ie_layers.h"
+#include "ie_blob.h"
 
 namespace InferenceEngine {
 
@@ -26,4 +36,284 @@ void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, co
     network.addLayer(newLayer);
 }
 
+namespace {
+
+bool isConst(const CNNLayerPtr &layer) {
+    return layer && CaselessEq<std::string>()(layer->type, "const") && layer->blobs.size() == 1 &&
+           layer->blobs.begin()->second;
+}
+
+bool isOutput(const ICNNNetwork &network, const DataPtr &data) {
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    return outputs.find(data->getName()) != outputs.end();
+}
+
+bool isFP32(const Blob::Ptr &blob) {
+    return blob && blob->precision() == Precision::FP32;
+}
+
+size_t product(const SizeVector &dims, size_t begin, size_t end) {
+    return std::accumulate(dims.begin() + begin, dims.begin() + end, static_cast<size_t>(1),
+                           std::multiplies<size_t>());
+}
+
+// Value of a per channel parameter, a blob of one element applies to all the channels
+float channelValue(const Blob::Ptr &blob, size_t channel) {
+    return blob->cbuffer().as<const float *>()[blob->size() == 1 ? 0 : channel];
+}
+
+bool isChannelParameter(const Blob::Ptr &blob, size_t channels) {
+    return isFP32(blob) && (blob->size() == 1 || blob->size() == channels);
+}
+
+/**
+ * @brief Gets y = x * scale[c] + shift[c] equal to the layer, false if the layer is not such a per channel transform
+ */
+bool getChannelTransform(const CNNLayerPtr &layer, size_t channels, std::vector<float> &scale,
+                         std::vector<float> &shift) {
+    scale.assign(channels, 1.f);
+    shift.assign(channels, 0.f);
+    if (auto bn = dynamic_cast<BatchNormalizationLayer *>(layer.get())) {
+        // weights are variances, biases are means
+        if (!isChannelParameter(bn->_weights, channels) || !isChannelParameter(bn->_biases, channels))
+            return false;
+        for (size_t c = 0; c < channels; c++) {
+            scale[c] = 1.f / std::sqrt(channelValue(bn->_weights, c) + bn->epsilon);
+            shift[c] = -channelValue(bn->_biases, c) * scale[c];
+        }
+        return true;
+    }
+    if (auto scaleShift = dynamic_cast<ScaleShiftLayer *>(layer.get())) {
+        if (!isChannelParameter(scaleShift->_weights, channels) ||
+            (scaleShift->_biases && !isChannelParameter(scaleShift->_biases, channels)))
+            return false;
+        for (size_t c = 0; c < channels; c++) {
+            scale[c] = channelValue(scaleShift->_weights, c);
+            if (scaleShift->_biases)
+                shift[c] = channelValue(scaleShift->_biases, c);
+        }
+        return true;
+    }
+    if (auto power = dynamic_cast<PowerLayer *>(layer.get())) {
+        if (power->power != 1.f)
+            return false;
+        scale.assign(channels, power->scale);
+        shift.assign(channels, power->offset);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Folds the per channel transform into the weights of the layer producing its input
+ */
+bool foldIntoWeights(details::CNNNetworkImpl &network, const CNNLayerPtr &layer) {
+    if (layer->precision != Precision::FP32 || layer->insData.size() != 1 || layer->outData.size() != 1)
+        return false;
+    auto data = layer->insData[0].lock();
+    auto producer = data->getCreatorLayer().lock();
+    // the input data disappears, so nothing else may use it
+    if (!producer || producer->outData.size() != 1 || data->getInputTo().size() != 1 || isOutput(network, data))
+        return false;
+
+    auto conv = dynamic_cast<ConvolutionLayer *>(producer.get());
+    auto fc = dynamic_cast<FullyConnectedLayer *>(producer.get());
+    if (!conv && !fc)
+        return false;
+    auto weightable = dynamic_cast<WeightableLayer *>(producer.get());
+    size_t channels = conv ? conv->_out_depth : fc->_out_num;
+    if (producer->precision != Precision::FP32 || channels == 0 || !isFP32(weightable->_weights) ||
+        weightable->_weights->size() % channels != 0 ||
+        (weightable->_biases && (!isFP32(weightable->_biases) || weightable->_biases->size() != channels)))
+        return false;
+
+    std::vector<float> scale, shift;
+    if (!getChannelTransform(layer, channels, scale, shift))
+        return false;
+
+    // the blobs may be shared with the original network, so the folded values go to new ones
+    auto weights = make_shared_blob<float>(weightable->_weights->getTensorDesc());
+    weights->allocate();
+    auto biases = make_shared_blob<float>(TensorDesc(Precision::FP32, {channels}, Layout::C));
+    biases->allocate();
+
+    size_t channelSize = weightable->_weights->size() / channels;
+    auto src = weightable->_weights->cbuffer().as<const float *>();
+    auto dst = weights->buffer().as<float *>();
+    auto srcBiases = weightable->_biases ? weightable->_biases->cbuffer().as<const float *>() : nullptr;
+    auto dstBiases = biases->buffer().as<float *>();
+    for (size_t c = 0; c < channels; c++) {
+        for (size_t i = 0; i < channelSize; i++)
+            dst[c * channelSize + i] = src[c * channelSize + i] * scale[c];
+        dstBiases[c] = (srcBiases ? srcBiases[c] : 0.f) * scale[c] + shift[c];
+    }
+    weightable->_weights = weights;
+    weightable->_biases = biases;
+    weightable->blobs["weights"] = weights;
+    weightable->blobs["biases"] = biases;
+
+    // the producer writes the output of the folded layer
+    auto output = layer->outData[0];
+    producer->outData[0] = output;
+    output->creatorLayer = producer;
+    network.removeData(data->getName());
+    network.removeLayer(layer->name);
+    return true;
+}
+
+/**
+ * @brief Computes the output of the layer for the constant inputs, nullptr if the layer is not supported
+ */
+Blob::Ptr evaluate(const CNNLayerPtr &layer, const std::vector<Blob::Ptr> &inputs) {
+    const auto &outDesc = layer->outData[0]->getTensorDesc();
+    const auto &dims = outDesc.getDims();
+    auto output = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, outDesc.getLayout()));
+    output->allocate();
+    auto dst = output->buffer().as<float *>();
+    size_t size = output->size();
+    auto src = [&](size_t i) { return inputs[i]->cbuffer().as<const float *>(); };
+    auto sameSize = [&]() {
+        for (auto &&input : inputs) {
+            if (input->size() != size)
+                return false;
+        }
+        return true;
+    };
+
+    CaselessEq<std::string> eq;
+    if (auto power = dynamic_cast<PowerLayer *>(layer.get())) {
+        if (!sameSize())
+            return nullptr;
+        for (size_t i = 0; i < size; i++)
+            dst[i] = std::pow(src(0)[i] * power->scale + power->offset, power->power);
+    } else if (auto relu = dynamic_cast<ReLULayer *>(layer.get())) {
+        if (!sameSize())
+            return nullptr;
+        for (size_t i = 0; i < size; i++)
+            dst[i] = src(0)[i] > 0.f ? src(0)[i] : src(0)[i] * relu->negative_slope;
+    } else if (auto eltwise = dynamic_cast<EltwiseLayer *>(layer.get())) {
+        if (!sameSize() || (!eltwise->coeff.empty() && eltwise->coeff.size() != inputs.size()))
+            return nullptr;
+        for (size_t i = 0; i < size; i++) {
+            float value = eltwise->coeff.empty() ? src(0)[i] : src(0)[i] * eltwise->coeff[0];
+            for (size_t j = 1; j < inputs.size(); j++) {
+                float operand = src(j)[i];
+                switch (eltwise->_operation) {
+                    case EltwiseLayer::Sum:
+                        value += eltwise->coeff.empty() ? operand : operand * eltwise->coeff[j];
+                        break;
+                    case EltwiseLayer::Prod:
+                        value *= operand;
+                        break;
+                    case EltwiseLayer::Max:
+                        value = std::max(value, operand);
+                        break;
+                }
+            }
+            dst[i] = value;
+        }
+    } else if (auto scaleShift = dynamic_cast<ScaleShiftLayer *>(layer.get())) {
+        size_t channels = dims.size() > 1 ? dims[1] : 1;
+        size_t inner = dims.size() > 2 ? product(dims, 2, dims.size()) : 1;
+        if (!sameSize() || !isChannelParameter(scaleShift->_weights, channels) ||
+            (scaleShift->_biases && !isChannelParameter(scaleShift->_biases, channels)))
+            return nullptr;
+        for (size_t i = 0; i < size; i++) {
+            size_t c = (i / inner) % channels;
+            dst[i] = src(0)[i] * channelValue(scaleShift->_weights, c) +
+                     (scaleShift->_biases ? channelValue(scaleShift->_biases, c) : 0.f);
+        }
+    } else if (auto concat = dynamic_cast<ConcatLayer *>(layer.get())) {
+        if (concat->_axis >= dims.size())
+            return nullptr;
+        size_t outer = product(dims, 0, concat->_axis);
+        size_t copied = 0;
+        for (size_t j = 0; j < inputs.size(); j++) {
+            if (inputs[j]->size() % outer != 0)
+                return nullptr;
+            copied += inputs[j]->size();
+        }
+        if (copied != size)
+            return nullptr;
+        size_t offset = 0;
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t j = 0; j < inputs.size(); j++) {
+                size_t block = inputs[j]->size() / outer;
+                std::copy(src(j) + o * block, src(j) + (o + 1) * block, dst + offset);
+                offset += block;
+            }
+        }
+    } else if (eq(layer->type, "Reshape") || eq(layer->type, "Flatten")) {
+        if (!sameSize())
+            return nullptr;
+        std::copy(src(0), src(0) + size, dst);
+    } else {
+        return nullptr;
+    }
+    return output;
+}
+
+/**
+ * @brief Replaces the layer with a Const layer if all its inputs are constant
+ */
+bool foldConstantLayer(details::CNNNetworkImpl &network, const CNNLayerPtr &layer, size_t &removed) {
+    if (isConst(layer) || layer->insData.empty() || layer->outData.size() != 1 ||
+        layer->precision != Precision::FP32 || isOutput(network, layer->outData[0]))
+        return false;
+    std::vector<Blob::Ptr> inputs;
+    for (auto &&in : layer->insData) {
+        auto creator = in.lock()->getCreatorLayer().lock();
+        if (!isConst(creator) || !isFP32(creator->blobs.begin()->second))
+            return false;
+        inputs.push_back(creator->blobs.begin()->second);
+    }
+    auto result = evaluate(layer, inputs);
+    if (!result)
+        return false;
+
+    // detach the inputs, constants which are not used anymore are removed
+    for (auto &&in : layer->insData) {
+        auto data = in.lock();
+        data->getInputTo().erase(layer->name);
+        auto creator = data->getCreatorLayer().lock();
+        if (data->getInputTo().empty() && creator->outData.size() == 1 && !isOutput(network, data)) {
+            network.removeData(data->getName());
+            network.removeLayer(creator->name);
+            removed++;
+        }
+    }
+    layer->insData.clear();
+
+    auto constLayer = std::make_shared<CNNLayer>(LayerParams{layer->name, "Const", layer->precision});
+    constLayer->affinity = layer->affinity;
+    constLayer->blobs["custom"] = result;
+    replaceLayerWithNewLayer(network, layer, constLayer);
+    return true;
+}
+
+}  // namespace
+
+INFERENCE_ENGINE_API_CPP(size_t) foldConstants(details::CNNNetworkImpl &network) {
+    size_t removed = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        // the network is changed while the layers are visited, so they are visited in a copy of the map
+        auto layers = network.allLayers();
+        for (auto &&it : layers) {
+            CNNLayerPtr current;
+            if (network.getLayerByName(it.first.c_str(), current, nullptr) != OK || current != it.second)
+                continue;
+            if (foldIntoWeights(network, current)) {
+                removed++;
+                changed = true;
+            } else if (foldConstantLayer(network, current, removed)) {
+                changed = true;
+            }
+        }
+    }
+    return removed;
+}
+
 }  // namespace InferenceEngine
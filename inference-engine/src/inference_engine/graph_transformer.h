@@ -11,6 +11,7 @@
 #pragma once
 
 #include <ie_icnn_network.hpp>
+#include "cnn_network_impl.hpp"
 
 namespace InferenceEngine {
 
@@ -22,4 +23,15 @@ namespace InferenceEngine {
  */
 void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, const CNNLayerPtr &newLayer);
 
+/**
+ * @brief Folds BatchNormalization, ScaleShift and Power (with power 1) layers which follow a Convolution or
+ * FullyConnected layer into its weights and biases, and replaces layers whose inputs are all Const layers with
+ * Const layers holding their results. Only FP32 layers are folded. The folded layers keep their output data,
+ * so the names of network outputs don't change; data which is a network output is never folded away.
+ * Weights are not modified in place, folded layers get new blobs.
+ * @param network - graph to transform
+ * @return the number of removed layers
+ */
+INFERENCE_ENGINE_API_CPP(size_t) foldConstants(details::CNNNetworkImpl &network);
+
 }  // namespace InferenceEngine
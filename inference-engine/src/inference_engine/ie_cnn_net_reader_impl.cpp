@@ -16,6 +16,7 @@
 #include <file_utils.h>
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
+#include "ie_util_internal.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
@@ -93,6 +94,20 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
     return SetWeights(weightsPtr, resp);
 }
 
+StatusCode CNNNetReaderImpl::ReleaseWeights(ResponseDesc* resp) noexcept {
+    if (network.get() == nullptr) {
+        return DescriptionBuffer(resp) << "network is empty";
+    }
+    try {
+        releaseNetworkBlobs(*network);
+    }
+    catch (const InferenceEngineException& iee) {
+        return DescriptionBuffer(resp) << iee.what();
+    }
+
+    return OK;
+}
+
 StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* resp) noexcept {
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_file(filepath);
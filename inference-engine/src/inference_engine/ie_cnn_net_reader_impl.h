@@ -43,6 +43,8 @@ public:
 
     StatusCode ReadWeights(const char *filepath, ResponseDesc *resp) noexcept override;
 
+    StatusCode ReleaseWeights(ResponseDesc *resp) noexcept override;
+
     ICNNNetwork *getNetwork(ResponseDesc *resp) noexcept override {
         return network.get();
     }
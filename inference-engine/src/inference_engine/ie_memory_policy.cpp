@@ -0,0 +1,190 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_memory_policy.hpp"
+#include "system_alllocator.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+enum class BlockKind : uint32_t {
+    Heap,
+    Mapped
+};
+
+// Stored right before the pointer returned to the user
+struct BlockHeader {
+    void *base;
+    size_t length;
+    BlockKind kind;
+};
+
+const size_t kHugePageSize = 2 * 1024 * 1024;
+// Smaller blocks are not worth a separate mapping: they neither benefit from huge pages
+// nor can be bound to a node without affecting their neighbours on the same page
+const size_t kMapThreshold = 256 * 1024;
+
+inline size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+size_t effectiveAlignment(size_t requested) {
+    size_t alignment = 64;
+    while (alignment < requested)
+        alignment <<= 1;
+    return alignment;
+}
+
+void *placeHeader(void *base, size_t length, BlockKind kind, size_t alignment) {
+    auto *user = static_cast<uint8_t *>(base) + alignment;
+    auto *header = reinterpret_cast<BlockHeader *>(user - sizeof(BlockHeader));
+    header->base = base;
+    header->length = length;
+    header->kind = kind;
+    return user;
+}
+
+void *allocateHeap(size_t size, size_t alignment) {
+    size_t total = size + alignment;
+    void *base = nullptr;
+#ifdef _WIN32
+    base = _aligned_malloc(total, alignment);
+#else
+    if (posix_memalign(&base, alignment, total) != 0)
+        base = nullptr;
+#endif
+    if (base == nullptr)
+        return nullptr;
+    return placeHeader(base, total, BlockKind::Heap, alignment);
+}
+
+#ifdef __linux__
+const int kMpolPreferred = 1;
+
+void bindToNode(void *base, size_t length, int node) {
+    if (node < 0)
+        return;
+    const size_t bitsPerWord = 8 * sizeof(unsigned long);
+    unsigned long mask[16] = {};
+    if (static_cast<size_t>(node) >= bitsPerWord * 16)
+        return;
+    mask[node / bitsPerWord] |= 1ul << (node % bitsPerWord);
+    // Preferred policy never fails the allocation when the node is exhausted,
+    // the kernel silently takes pages from the nearest node instead
+    syscall(SYS_mbind, base, length, kMpolPreferred, mask, bitsPerWord * 16, 0);
+}
+
+void *allocateMapped(size_t size, size_t alignment, const MemoryPolicy &policy) {
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void *base = MAP_FAILED;
+    size_t length = 0;
+
+    if (policy.hugePages == HugePagesMode::Explicit) {
+        length = roundUp(size + alignment, kHugePageSize);
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (base == MAP_FAILED) {
+        length = roundUp(size + alignment, policy.hugePages == HugePagesMode::None ? pageSize : kHugePageSize);
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            return nullptr;
+        if (policy.hugePages != HugePagesMode::None)
+            madvise(base, length, MADV_HUGEPAGE);
+    }
+
+    if (policy.numaNode != MemoryPolicy::NUMA_FIRST_TOUCH) {
+        int node = policy.numaNode == MemoryPolicy::NUMA_LOCAL ? getCurrentNumaNode() : policy.numaNode;
+        bindToNode(base, length, node);
+    }
+
+    return placeHeader(base, length, BlockKind::Mapped, alignment);
+}
+#endif
+
+}  // namespace
+
+void *alignedAlloc(size_t size, const MemoryPolicy &policy) noexcept {
+    size_t alignment = effectiveAlignment(policy.alignment);
+#ifdef __linux__
+    bool needsMapping = policy.hugePages != HugePagesMode::None ||
+                        policy.numaNode != MemoryPolicy::NUMA_FIRST_TOUCH;
+    if (needsMapping && size >= kMapThreshold) {
+        void *ptr = allocateMapped(size, alignment, policy);
+        if (ptr != nullptr)
+            return ptr;
+    }
+#endif
+    return allocateHeap(size, alignment);
+}
+
+void alignedFree(void *ptr) noexcept {
+    if (ptr == nullptr)
+        return;
+    auto *header = reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(ptr) - sizeof(BlockHeader));
+#ifdef __linux__
+    if (header->kind == BlockKind::Mapped) {
+        munmap(header->base, header->length);
+        return;
+    }
+#endif
+#ifdef _WIN32
+    _aligned_free(header->base);
+#else
+    free(header->base);
+#endif
+}
+
+size_t alignedReservedSize(const void *ptr) noexcept {
+    if (ptr == nullptr)
+        return 0;
+    auto *header = reinterpret_cast<const BlockHeader *>(static_cast<const uint8_t *>(ptr) - sizeof(BlockHeader));
+    return header->length;
+}
+
+int getCurrentNumaNode() noexcept {
+#ifdef __linux__
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return static_cast<int>(node);
+#endif
+    return 0;
+}
+
+int getNumaNodesCount() noexcept {
+#ifdef __linux__
+    try {
+        // The file holds a list of ranges, e.g. "0-1" or "0,2-3"
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string ranges;
+        if (online >> ranges) {
+            size_t last = ranges.find_last_of(",-");
+            int maxNode = std::stoi(last == std::string::npos ? ranges : ranges.substr(last + 1));
+            return maxNode + 1;
+        }
+    } catch (...) {
+    }
+#endif
+    return 1;
+}
+
+std::shared_ptr<IAllocator> CreateSystemAllocator(const MemoryPolicy &policy) {
+    return details::shared_from_irelease(new SystemMemoryAllocator(policy));
+}
+
+}  // namespace InferenceEngine
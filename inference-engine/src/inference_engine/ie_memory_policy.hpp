@@ -0,0 +1,85 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Aligned, huge-page and NUMA aware host memory allocation used by blobs and plugin workspaces
+ * @file ie_memory_policy.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ie_api.h>
+#include <ie_allocator.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Huge pages usage for a host allocation
+ */
+enum class HugePagesMode {
+    /** Regular pages only */
+    None,
+    /** Large allocations are advised to the kernel as transparent huge page candidates (madvise) */
+    Transparent,
+    /** Large allocations are taken from the hugetlbfs pool, falls back to Transparent if the pool is empty */
+    Explicit
+};
+
+/**
+ * @brief Describes where and how host memory should be allocated
+ */
+struct MemoryPolicy {
+    /** Node id is not forced, pages are placed by the first touch */
+    static constexpr int NUMA_FIRST_TOUCH = -1;
+    /** Pages are bound to the NUMA node of the thread which performs the allocation */
+    static constexpr int NUMA_LOCAL = -2;
+
+    /** Alignment of the returned pointer in bytes, a power of two not less than 64 */
+    size_t alignment = 64;
+    HugePagesMode hugePages = HugePagesMode::None;
+    /** NUMA_FIRST_TOUCH, NUMA_LOCAL or an explicit node id */
+    int numaNode = NUMA_FIRST_TOUCH;
+
+    bool isDefault() const {
+        return alignment == 64 && hugePages == HugePagesMode::None && numaNode == NUMA_FIRST_TOUCH;
+    }
+};
+
+/**
+ * @brief Allocates host memory according to the policy
+ * @param size Size in bytes
+ * @param policy Alignment, huge pages and NUMA placement to apply
+ * @return Pointer to the memory or nullptr if the allocation failed. Must be released with alignedFree()
+ */
+INFERENCE_ENGINE_API_CPP(void*) alignedAlloc(size_t size, const MemoryPolicy& policy = MemoryPolicy()) noexcept;
+
+/**
+ * @brief Releases memory obtained from alignedAlloc(). nullptr is ignored
+ */
+INFERENCE_ENGINE_API_CPP(void) alignedFree(void* ptr) noexcept;
+
+/**
+ * @brief Returns the number of bytes reserved for a block from alignedAlloc(), including the alignment
+ * and the page rounding, 0 for nullptr
+ */
+INFERENCE_ENGINE_API_CPP(size_t) alignedReservedSize(const void* ptr) noexcept;
+
+/**
+ * @brief Returns the NUMA node of the CPU the calling thread runs on, 0 if it cannot be detected
+ */
+INFERENCE_ENGINE_API_CPP(int) getCurrentNumaNode() noexcept;
+
+/**
+ * @brief Returns the number of NUMA nodes available in the system, at least 1
+ */
+INFERENCE_ENGINE_API_CPP(int) getNumaNodesCount() noexcept;
+
+/**
+ * @brief Creates an allocator for blobs which follows the given policy
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateSystemAllocator(const MemoryPolicy& policy);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,173 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_parallel.hpp"
+
+#if IE_THREAD == IE_THREAD_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+struct ThreadContext {
+    int ithr = 0;
+    int nthr = 1;
+    int maxThreads = 0;
+};
+
+thread_local ThreadContext context;
+
+/**
+ * Job is split into nthr slots. Slots are claimed one by one by the pool workers and by the thread which
+ * started the job, so a job is never blocked by workers busy with other jobs or by nested calls.
+ */
+struct Job {
+    Job(int nthr, const std::function<void(int, int)> &func) : func(func), nthr(nthr) {}
+
+    const std::function<void(int, int)> &func;
+    const int nthr;
+    std::atomic<int> next {0};
+    std::atomic<int> done {0};
+    std::exception_ptr error = nullptr;
+    std::mutex guard;
+    std::condition_variable finished;
+
+    bool exhausted() const {
+        return next.load() >= nthr;
+    }
+
+    void runSlots() {
+        int slot;
+        while ((slot = next.fetch_add(1)) < nthr) {
+            ThreadContext saved = context;
+            context.ithr = slot;
+            context.nthr = nthr;
+            try {
+                func(slot, nthr);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(guard);
+                if (!error) error = std::current_exception();
+            }
+            context = saved;
+
+            if (done.fetch_add(1) + 1 == nthr) {
+                std::lock_guard<std::mutex> lock(guard);
+                finished.notify_all();
+            }
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(guard);
+        finished.wait(lock, [this] { return done.load() == nthr; });
+    }
+};
+
+class ThreadPool {
+public:
+    static ThreadPool &instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    int size() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    void run(int nthr, const std::function<void(int, int)> &func) {
+        auto job = std::make_shared<Job>(nthr, func);
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            jobs.push_back(job);
+        }
+        queueCondVar.notify_all();
+
+        job->runSlots();
+        job->wait();
+
+        if (job->error)
+            std::rethrow_exception(job->error);
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopped = true;
+        }
+        queueCondVar.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+private:
+    ThreadPool() {
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 1; i < threads; i++)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+    void workerLoop() {
+        while (true) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                queueCondVar.wait(lock, [this] {
+                    while (!jobs.empty() && jobs.front()->exhausted())
+                        jobs.pop_front();
+                    return stopped || !jobs.empty();
+                });
+                if (stopped)
+                    return;
+                job = jobs.front();
+            }
+            job->runSlots();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::deque<std::shared_ptr<Job>> jobs;
+    std::mutex queueMutex;
+    std::condition_variable queueCondVar;
+    bool stopped = false;
+};
+
+}  // namespace
+
+void parallelPoolRun(int nthr, const std::function<void(int, int)> &func) {
+    ThreadPool::instance().run(nthr, func);
+}
+
+int parallelPoolMaxThreads() {
+    int poolSize = ThreadPool::instance().size();
+    return context.maxThreads > 0 ? std::min(context.maxThreads, poolSize) : poolSize;
+}
+
+void parallelPoolSetMaxThreads(int nthr) {
+    context.maxThreads = std::max(nthr, 0);
+}
+
+int parallelPoolThreadNum() {
+    return context.ithr;
+}
+
+int parallelPoolNumThreads() {
+    return context.nthr;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
+
+#endif  // IE_THREAD == IE_THREAD_POOL
@@ -25,6 +25,8 @@
 #include <ittnotify.h>
 #endif
 
+#include "ie_tracer.hpp"
+
 namespace InferenceEngine {
 
 template< typename Static, typename Block>
@@ -210,10 +212,12 @@ inline static void annotateEnd(TimeResultsMap& m, TimeSampler& t) {
 #define IE_STR(x) IE_STR_(x)
 #define IE_STR_(x) #x
 
-#define IE_PROFILING_AUTO_SCOPE(NAME) IE_ITT_SCOPE(IE_STR(NAME)); IE_TIMER_SCOPE(IE_STR(NAME));
+#define IE_PROFILING_AUTO_SCOPE(NAME) IE_ITT_SCOPE(IE_STR(NAME)); IE_TIMER_SCOPE(IE_STR(NAME)); IE_TRACE_SCOPE(IE_STR(NAME), "ie")
 
 struct ProfilingTask {
     std::string name;
+    // Attached to the trace events of the task, e.g. the implementation type of a layer
+    std::string details;
 
 #if ENABLE_PROFILING_ITT
     __itt_domain*        domain;
@@ -262,6 +266,7 @@ inline static void annotateEnd(IttStatic&, IttProfilingTask& t) {
     #define IE_ITT_TASK_SCOPE(profiling_task)
 #endif
 
-#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) IE_ITT_TASK_SCOPE(PROFILING_TASK); IE_TIMER_SCOPE(PROFILING_TASK.name);
+#define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) IE_ITT_TASK_SCOPE(PROFILING_TASK); IE_TIMER_SCOPE(PROFILING_TASK.name); \
+    IE_TRACE_TASK_SCOPE(PROFILING_TASK)
 
 }  // namespace InferenceEngine
@@ -0,0 +1,315 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+namespace Tracing {
+
+namespace details {
+std::atomic<bool> enabled(false);
+}  // namespace details
+
+namespace {
+
+struct Event {
+    // Odd while the owning thread writes the event, so that a concurrent dump can skip it
+    std::atomic<uint32_t> sequence;
+    uint32_t tid;
+    bool async;
+    uint64_t start;
+    uint64_t end;
+    char name[80];
+    char category[16];
+    char detail[64];
+};
+
+struct EventSnapshot {
+    uint32_t tid;
+    bool async;
+    uint64_t start;
+    uint64_t end;
+    std::string name;
+    std::string category;
+    std::string detail;
+};
+
+void copyTruncated(char *dst, const char *src, size_t size) {
+    if (src == nullptr) {
+        dst[0] = '\0';
+        return;
+    }
+    size_t len = std::min(strlen(src), size - 1);
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+/**
+ * Fixed size ring of events written by a single thread. A buffer released by an exited thread is reused
+ * by the next new thread.
+ */
+class EventBuffer {
+public:
+    static constexpr size_t capacity = 8192;
+
+    EventBuffer() : events(new Event[capacity]), head(0), owned(false) {
+        for (size_t i = 0; i < capacity; i++)
+            events[i].sequence.store(0, std::memory_order_relaxed);
+    }
+
+    void write(uint32_t tid, bool async, const char *name, const char *category, const char *detail,
+               uint64_t start, uint64_t end) {
+        uint64_t pos = head.load(std::memory_order_relaxed);
+        Event &e = events[pos % capacity];
+        uint32_t seq = e.sequence.load(std::memory_order_relaxed);
+        e.sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        e.tid = tid;
+        e.async = async;
+        e.start = start;
+        e.end = end;
+        copyTruncated(e.name, name, sizeof(e.name));
+        copyTruncated(e.category, category, sizeof(e.category));
+        copyTruncated(e.detail, detail, sizeof(e.detail));
+        e.sequence.store(seq + 2, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_release);
+    }
+
+    void read(std::vector<EventSnapshot> &out) const {
+        uint64_t last = head.load(std::memory_order_acquire);
+        uint64_t first = last > capacity ? last - capacity : 0;
+        for (uint64_t pos = std::max(first, cleared.load(std::memory_order_acquire)); pos < last; pos++) {
+            const Event &e = events[pos % capacity];
+            uint32_t seq = e.sequence.load(std::memory_order_acquire);
+            if (seq & 1) continue;
+            EventSnapshot s{e.tid, e.async, e.start, e.end, e.name, e.category, e.detail};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (e.sequence.load(std::memory_order_relaxed) != seq) continue;
+            out.push_back(std::move(s));
+        }
+    }
+
+    void clear() {
+        cleared.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    std::unique_ptr<Event[]> events;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> cleared{0};
+    std::atomic<bool> owned;
+};
+
+class Registry {
+public:
+    Registry() : nextTid(1) {
+        const char *file = std::getenv("IE_TRACE_FILE");
+        if (file != nullptr && file[0] != '\0') {
+            dumpFile = file;
+            details::enabled.store(true);
+        }
+    }
+
+    ~Registry() {
+        if (!dumpFile.empty()) {
+            try {
+                Dump(dumpFile);
+            } catch (...) {}
+        }
+    }
+
+    EventBuffer *acquire(uint32_t &tid) {
+        std::lock_guard<std::mutex> lock(mutex);
+        tid = nextTid++;
+        for (auto &buffer : buffers) {
+            bool expected = false;
+            if (buffer->owned.compare_exchange_strong(expected, true))
+                return buffer;
+        }
+        buffers.push_back(new EventBuffer());
+        buffers.back()->owned.store(true);
+        return buffers.back();
+    }
+
+    std::vector<EventSnapshot> snapshot() {
+        std::vector<EventSnapshot> events;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &buffer : buffers)
+            buffer->read(events);
+        return events;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &buffer : buffers)
+            buffer->clear();
+    }
+
+private:
+    std::mutex mutex;
+    // Buffers are never freed, threads may exit after the registry is destroyed at unload
+    std::vector<EventBuffer *> buffers;
+    uint32_t nextTid;
+    std::string dumpFile;
+};
+
+Registry &registry() {
+    static Registry instance;
+    return instance;
+}
+
+// Makes sure the environment is checked when the library is loaded, not on the first dump
+struct RegistryInitializer {
+    RegistryInitializer() { registry(); }
+} registryInitializer;
+
+/**
+ * Binds a buffer to the thread on the first recorded event and gives it back when the thread exits
+ */
+struct ThreadBuffer {
+    EventBuffer *buffer = nullptr;
+    uint32_t tid = 0;
+
+    EventBuffer *get() {
+        if (buffer == nullptr)
+            buffer = registry().acquire(tid);
+        return buffer;
+    }
+
+    ~ThreadBuffer() {
+        if (buffer != nullptr)
+            buffer->owned.store(false, std::memory_order_release);
+    }
+};
+
+thread_local ThreadBuffer threadBuffer;
+
+void record(bool async, const char *name, const char *category, const char *detail,
+            uint64_t startNs, uint64_t endNs) noexcept {
+    try {
+        EventBuffer *buffer = threadBuffer.get();
+        buffer->write(threadBuffer.tid, async, name, category, detail, startNs, endNs);
+    } catch (...) {
+        // Tracing must never break inference, an event is dropped if a buffer can't be allocated
+    }
+}
+
+void writeJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    const char *hex = "0123456789abcdef";
+                    out << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+uint64_t Now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Record(const char *name, const char *category, const char *detail, uint64_t startNs, uint64_t endNs) noexcept {
+    record(false, name, category, detail, startNs, endNs);
+}
+
+void RecordAsync(const char *name, const char *category, const char *detail, uint64_t startNs, uint64_t endNs) noexcept {
+    record(true, name, category, detail, startNs, endNs);
+}
+
+void Enable(bool enable) {
+    details::enabled.store(enable);
+}
+
+bool IsEnabled() {
+    return details::enabled.load();
+}
+
+void Clear() {
+    registry().clear();
+}
+
+void Dump(std::ostream &out) {
+    auto events = registry().snapshot();
+    std::sort(events.begin(), events.end(), [](const EventSnapshot &a, const EventSnapshot &b) {
+        return a.start < b.start;
+    });
+    uint64_t origin = events.empty() ? 0 : events.front().start;
+
+    // Chrome trace timestamps are in microseconds
+    auto writeTime = [&](const char *key, uint64_t ns) {
+        out << ",\"" << key << "\":" << ns / 1000 << '.' << ns % 1000 / 100;
+    };
+    auto writeHeader = [&](const EventSnapshot &e, const char *phase) {
+        out << "{\"name\":";
+        writeJsonString(out, e.name);
+        out << ",\"cat\":";
+        writeJsonString(out, e.category);
+        out << ",\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << e.tid;
+    };
+    auto writeArgs = [&](const EventSnapshot &e) {
+        if (!e.detail.empty()) {
+            out << ",\"args\":{\"detail\":";
+            writeJsonString(out, e.detail);
+            out << "}";
+        }
+        out << "}";
+    };
+
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); i++) {
+        const auto &e = events[i];
+        out << (i ? ",\n" : "\n");
+        if (e.async) {
+            // A begin/end pair with a unique id gets its own track in the viewer
+            writeHeader(e, "b");
+            out << ",\"id\":" << i;
+            writeTime("ts", e.start - origin);
+            writeArgs(e);
+            out << ",\n";
+            writeHeader(e, "e");
+            out << ",\"id\":" << i;
+            writeTime("ts", e.end - origin);
+            out << "}";
+        } else {
+            writeHeader(e, "X");
+            writeTime("ts", e.start - origin);
+            writeTime("dur", e.end - e.start);
+            writeArgs(e);
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Dump(const std::string &fileName) {
+    std::ofstream out(fileName);
+    if (!out.good())
+        THROW_IE_EXCEPTION << "Failed to open trace file " << fileName;
+    Dump(out);
+}
+
+}  // namespace Tracing
+}  // namespace InferenceEngine
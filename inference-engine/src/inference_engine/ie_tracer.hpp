@@ -0,0 +1,80 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "ie_api.h"
+#include "ie_tracing.hpp"
+
+namespace InferenceEngine {
+namespace Tracing {
+
+namespace details {
+extern INFERENCE_ENGINE_API_CLASS(std::atomic<bool>) enabled;
+}  // namespace details
+
+/**
+ * Returns true if events should be recorded. This is the only cost of a trace scope when tracing is disabled.
+ */
+inline bool IsActive() noexcept {
+    return details::enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns monotonic time in nanoseconds
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) Now() noexcept;
+
+/**
+ * Appends a complete event to the ring buffer of the calling thread. The strings are copied (and truncated
+ * if they are too long), so they don't need to outlive the call. The buffer is owned by the calling thread,
+ * so no locks are taken.
+ */
+INFERENCE_ENGINE_API_CPP(void) Record(const char *name, const char *category, const char *detail,
+                                      uint64_t startNs, uint64_t endNs) noexcept;
+
+/**
+ * Same as Record, but the event is shown on its own track instead of the timeline of the calling thread.
+ * Used for intervals which don't nest with the scopes of the thread, e.g. the time a task waits in a queue.
+ */
+INFERENCE_ENGINE_API_CPP(void) RecordAsync(const char *name, const char *category, const char *detail,
+                                           uint64_t startNs, uint64_t endNs) noexcept;
+
+/**
+ * Records the lifetime of the scope if tracing was enabled when the scope was entered
+ */
+class TraceScope {
+    const char *_name;
+    const char *_category;
+    const char *_detail;
+    uint64_t _start;
+
+public:
+    explicit TraceScope(const char *name, const char *category = "ie", const char *detail = nullptr) noexcept
+            : _name(name), _category(category), _detail(detail), _start(IsActive() ? Now() : 0) {}
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+    ~TraceScope() {
+        if (_start != 0)
+            Record(_name, _category, _detail, _start, Now());
+    }
+};
+
+}  // namespace Tracing
+}  // namespace InferenceEngine
+
+#define IE_TRACE_CONCAT(x, y) IE_TRACE_CONCAT_EVAL(x, y)
+#define IE_TRACE_CONCAT_EVAL(x, y) x ## y
+
+#define IE_TRACE_SCOPE(NAME, CATEGORY) \
+    ::InferenceEngine::Tracing::TraceScope IE_TRACE_CONCAT(__ie_trace_scope_, __LINE__)(NAME, CATEGORY);
+
+#define IE_TRACE_TASK_SCOPE(PROFILING_TASK) \
+    ::InferenceEngine::Tracing::TraceScope IE_TRACE_CONCAT(__ie_trace_scope_, __LINE__)( \
+        (PROFILING_TASK).name.c_str(), "task", (PROFILING_TASK).details.empty() ? nullptr : (PROFILING_TASK).details.c_str());
@@ -7,6 +7,8 @@
 #include "graph_tools.hpp"
 #include "caseless.hpp"
 #include "ie_utils.hpp"
+#include "ie_blob_proxy.hpp"
+#include "blob_factory.hpp"
 
 #include <ie_layers.h>
 
@@ -19,6 +21,7 @@
 #include <memory>
 #include <utility>
 #include <iomanip>
+#include <cstring>
 
 namespace InferenceEngine {
 
@@ -302,6 +305,65 @@ details::CNNNetworkImplPtr cloneNet(const std::vector<CNNLayerPtr>& layers,
     return net;
 }
 
+namespace {
+
+bool isBlobProxy(const Blob::Ptr &blob) {
+    return std::dynamic_pointer_cast<TBlobProxy<float>>(blob) ||
+           std::dynamic_pointer_cast<TBlobProxy<short>>(blob) ||
+           std::dynamic_pointer_cast<TBlobProxy<uint8_t>>(blob);
+}
+
+Blob::Ptr detachBlob(const Blob::Ptr &blob) {
+    if (!blob || !isBlobProxy(blob))
+        return blob;
+    auto copy = make_blob_with_precision(blob->getTensorDesc());
+    copy->allocate();
+    memcpy(copy->buffer(), blob->cbuffer(), blob->byteSize());
+    return copy;
+}
+
+}  // namespace
+
+void detachLayerBlobs(CNNLayer &layer) {
+    auto weightable = dynamic_cast<WeightableLayer *>(&layer);
+    for (auto &blob : layer.blobs) {
+        auto copy = detachBlob(blob.second);
+        if (weightable && weightable->_weights == blob.second)
+            weightable->_weights = copy;
+        if (weightable && weightable->_biases == blob.second)
+            weightable->_biases = copy;
+        blob.second = copy;
+    }
+    if (weightable) {
+        weightable->_weights = detachBlob(weightable->_weights);
+        weightable->_biases = detachBlob(weightable->_biases);
+    }
+}
+
+void releaseNetworkBlobs(ICNNNetwork &network) {
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *i;
+        layer->blobs.clear();
+        if (auto weightable = dynamic_cast<WeightableLayer *>(layer.get())) {
+            weightable->_weights.reset();
+            weightable->_biases.reset();
+        }
+        i++;
+    }
+
+    // Mean images are small but point into the same buffer as weights, so they are copied rather than dropped
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto &input : inputs) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+            if (pp[c]->meanData)
+                pp[c]->meanData = detachBlob(pp[c]->meanData);
+        }
+    }
+}
+
 namespace traverse {
 
 void forward(const CNNLayerPtr& layer, std::deque<InferenceEngine::CNNLayerPtr>& layers) {
@@ -81,6 +81,22 @@ cloneNet(const std::vector<InferenceEngine::CNNLayerPtr>& layers,
 INFERENCE_ENGINE_API_CPP(InferenceEngine::details::CNNNetworkImplPtr)
 cloneNet(const InferenceEngine::ICNNNetwork &network);
 
+/**
+ * @brief Replaces blobs of the layer which are windows into a bigger buffer (e.g. the whole IR .bin)
+ * by compact copies, so that the buffer is not kept alive by the layer and its users
+ *
+ * @param layer - layer to process
+ */
+INFERENCE_ENGINE_API_CPP(void) detachLayerBlobs(CNNLayer &layer);
+
+/**
+ * @brief Drops weights and other blobs of all layers of the network and detaches its mean images
+ * from the IR buffer. The network can't be loaded to a plugin anymore after the call.
+ *
+ * @param network - network to process
+ */
+INFERENCE_ENGINE_API_CPP(void) releaseNetworkBlobs(ICNNNetwork &network);
+
 namespace traverse {
 
 INFERENCE_ENGINE_API_CPP(void)
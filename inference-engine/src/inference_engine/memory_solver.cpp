@@ -8,6 +8,8 @@
 #include "details/ie_exception.hpp"
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -41,55 +43,181 @@ MemorySolver::MemorySolver(const std::vector<Box> boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+namespace {
+
+/**
+ * Segment tree over time slots. Each box is registered in O(log T) nodes, so a query for
+ * all boxes alive during some time range visits only the nodes on the range borders.
+ */
+class TimeIndex {
+public:
+    explicit TimeIndex(int duration) : _duration(duration), _cover(4 * duration), _touch(4 * duration) {}
+
+    void insert(int item, int start, int finish) {
+        insert(1, 0, _duration - 1, item, start, finish);
     }
-}
 
-int MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
+    /** Appends items which live time intersects [start, finish]. Items may be repeated. */
+    void query(int start, int finish, std::vector<int> &items) const {
+        query(1, 0, _duration - 1, start, finish, items);
+    }
+
+private:
+    int _duration;
+    std::vector<std::vector<int>> _cover;  // items covering whole node range
+    std::vector<std::vector<int>> _touch;  // items intersecting node range
+
+    void insert(int node, int lo, int hi, int item, int start, int finish) {
+        if (finish < lo || hi < start) return;
+        _touch[node].push_back(item);
+        if (start <= lo && hi <= finish) {
+            _cover[node].push_back(item);
+            return;
+        }
+        int mid = (lo + hi) / 2;
+        insert(2 * node, lo, mid, item, start, finish);
+        insert(2 * node + 1, mid + 1, hi, item, start, finish);
+    }
+
+    void query(int node, int lo, int hi, int start, int finish, std::vector<int> &items) const {
+        if (finish < lo || hi < start) return;
+        if (start <= lo && hi <= finish) {
+            items.insert(items.end(), _touch[node].begin(), _touch[node].end());
+            return;
+        }
+        items.insert(items.end(), _cover[node].begin(), _cover[node].end());
+        int mid = (lo + hi) / 2;
+        query(2 * node, lo, mid, start, finish, items);
+        query(2 * node + 1, mid + 1, hi, start, finish, items);
+    }
+};
+
+class Packer {
+public:
+    Packer(const std::vector<MemorySolver::Box> &boxes, int duration)
+            : _boxes(boxes), _index(duration), _offsets(boxes.size(), -1), _stamp(boxes.size(), -1) {}
+
+    int pack(MemorySolver::Strategy strategy) {
+        std::vector<int> order(_boxes.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<int>(i);
+
+        // boxes are already sorted by start and finish, that is the order for BY_LIFETIME
+        if (strategy != MemorySolver::Strategy::BY_LIFETIME) {
+            std::stable_sort(order.begin(), order.end(), [&](int l, int r) {
+                return _boxes[l].size > _boxes[r].size;
+            });
+        }
+
+        bool best_fit = strategy == MemorySolver::Strategy::BEST_FIT;
+        for (int i : order) {
+            _offsets[i] = findOffset(i, best_fit);
+            _index.insert(i, _boxes[i].start, _boxes[i].finish);
+        }
+
+        if (strategy == MemorySolver::Strategy::BY_SIZE) compact();
+
+        int required = 0;
+        for (size_t i = 0; i < _boxes.size(); i++)
+            required = std::max(required, _offsets[i] + _boxes[i].size);
+        return required;
+    }
+
+    const std::vector<int> &offsets() const { return _offsets; }
+
+private:
+    const std::vector<MemorySolver::Box> &_boxes;
+    TimeIndex _index;
+    std::vector<int> _offsets;   // per box, -1 means not placed yet
+    std::vector<int> _stamp;     // last query which has seen the box, to skip repeats
+    int _query = 0;
+    std::vector<int> _items;
+    std::vector<std::pair<int, int>> _busy;
+
+    /** Lowest free offset (or the tightest gap for best fit) for the box among placed ones */
+    int findOffset(int box, bool best_fit) {
+        const MemorySolver::Box &b = _boxes[box];
+        _items.clear();
+        _busy.clear();
+        _index.query(b.start, b.finish, _items);
+        _query++;
+        for (int item : _items) {
+            if (item == box || _stamp[item] == _query) continue;
+            _stamp[item] = _query;
+            _busy.emplace_back(_offsets[item], _offsets[item] + _boxes[item].size);
+        }
+        std::sort(_busy.begin(), _busy.end());
+
+        int top = 0, best = -1, best_gap = std::numeric_limits<int>::max();
+        for (const auto &busy : _busy) {
+            int gap = busy.first - top;
+            if (gap >= b.size) {
+                if (!best_fit) return top;
+                if (gap < best_gap) {
+                    best_gap = gap;
+                    best = top;
                 }
             }
-        } while (popped_up);
+            top = std::max(top, busy.second);
+        }
+        return best == -1 ? top : best;
+    }
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+    /**
+     * Local improvement. Drops boxes down to the lowest free offset in order of their
+     * current offsets. A box never moves up, so the packing can only get tighter.
+     */
+    void compact() {
+        std::vector<int> order(_boxes.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<int>(i);
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;
+        const int max_passes = 4;
+        bool moved = true;
+        for (int pass = 0; pass < max_passes && moved; pass++) {
+            moved = false;
+            std::sort(order.begin(), order.end(), [&](int l, int r) {
+                return _offsets[l] < _offsets[r] || (_offsets[l] == _offsets[r] && l < r);
+            });
+            for (int i : order) {
+                int offset = findOffset(i, false);
+                if (offset < _offsets[i]) {
+                    _offsets[i] = offset;
+                    moved = true;
+                }
+            }
+        }
     }
+};
+
+}  // namespace
 
-    return _min_required;
+int MemorySolver::solve(Strategy strategy) {
+    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    std::vector<Strategy> strategies;
+    if (strategy == Strategy::BEST)
+        strategies = {Strategy::BY_SIZE, Strategy::BY_LIFETIME, Strategy::BEST_FIT};
+    else
+        strategies = {strategy};
+
+    int min_required = std::numeric_limits<int>::max();
+    std::vector<int> offsets;
+    for (Strategy s : strategies) {
+        Packer packer(_boxes, _time_duration);
+        int required = packer.pack(s);
+        if (required < min_required) {
+            min_required = required;
+            offsets = packer.offsets();
+            _solved_by = s;
+        }
+        // Nothing can be better than the lower bound
+        if (min_required == _depth) break;
+    }
+
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = offsets[i];
+    _solved_size = _boxes.empty() ? 0 : min_required;
+    return _solved_size;
 }
 
 int MemorySolver::maxDepth() {
@@ -102,6 +230,14 @@ int MemorySolver::maxTopDepth() {
     return _top_depth;
 }
 
+int MemorySolver::solvedSize() const {
+    return _solved_size;
+}
+
+MemorySolver::Strategy MemorySolver::solvedBy() const {
+    return _solved_by;
+}
+
 int MemorySolver::getOffset(int id) const {
     auto res = _offsets.find(id);
     if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
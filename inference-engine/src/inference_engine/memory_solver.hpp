@@ -41,6 +41,10 @@ namespace InferenceEngine {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  Conflicting boxes are looked up through an interval index over the exec order, so
+ *  the cost of placement depends on the number of really overlapping boxes rather than
+ *  on the total number of boxes multiplied by their live time.
  */
 
 class INFERENCE_ENGINE_API_CLASS(MemorySolver) {
@@ -64,13 +68,27 @@ public:
         int id;
     };
 
+    /** @brief Packing heuristic used to place boxes on Mem axis */
+    enum class Strategy {
+        /** Biggest boxes first, each one at the lowest free offset, followed by compaction */
+        BY_SIZE,
+        /** Boxes in order of their first use, each one at the lowest free offset */
+        BY_LIFETIME,
+        /** Biggest boxes first, each one into the tightest free gap which can hold it */
+        BEST_FIT,
+        /** Run all heuristics above and keep the smallest result */
+        BEST
+    };
+
     explicit MemorySolver(const std::vector<Box> boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy Packing heuristic. BEST gives the tightest packing for the price of
+     *        several runs.
      * @return Size of common memory blob required for storing all
      */
-    int solve();
+    int solve(Strategy strategy = Strategy::BY_SIZE);
 
     /** Provides calculated offset for specified box id */
     int getOffset(int id) const;
@@ -80,9 +98,19 @@ public:
     /** Additional info. Max num of boxes required for any time stamp. */
     int maxTopDepth();
 
+    /**
+     * Additional info. Size found by the last solve() call or -1 if there was no call.
+     * It can't be less than maxDepth(), which is the lower bound for any packing.
+     */
+    int solvedSize() const;
+    /** Additional info. Heuristic which gave the result of the last solve() call. */
+    Strategy solvedBy() const;
+
 private:
     std::vector<Box> _boxes;
     std::map<int, int> _offsets;
+    int _solved_size = -1;
+    Strategy _solved_by = Strategy::BY_SIZE;
     int _top_depth = -1;
     int _depth = -1;
     int _time_duration = -1;
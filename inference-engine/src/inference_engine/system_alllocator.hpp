@@ -7,9 +7,14 @@
 
 #include <iostream>
 #include "ie_allocator.hpp"
+#include "ie_memory_policy.hpp"
 
 class SystemMemoryAllocator : public InferenceEngine::IAllocator {
  public:
+    SystemMemoryAllocator() = default;
+
+    explicit SystemMemoryAllocator(const InferenceEngine::MemoryPolicy &policy) : policy(policy) {}
+
     void Release() noexcept override {
         delete this;
     }
@@ -21,19 +26,14 @@ class SystemMemoryAllocator : public InferenceEngine::IAllocator {
     void unlock(void * a) noexcept override {}
 
     void * alloc(size_t size) noexcept override {
-        try {
-            auto handle = reinterpret_cast<void*>(new char[size]);
-            return handle;
-        }catch(...) {
-            return nullptr;
-        }
+        return InferenceEngine::alignedAlloc(size, policy);
     }
 
     bool   free(void* handle) noexcept override {
-        try {
-            delete[] reinterpret_cast<char*>(handle);
-        }catch(...)
-        {   }
+        InferenceEngine::alignedFree(handle);
         return true;
     }
+
+ private:
+    InferenceEngine::MemoryPolicy policy;
 };
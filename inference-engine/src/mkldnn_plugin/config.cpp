@@ -9,6 +9,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <algorithm>
 #include <cpp_interfaces/exception2status.hpp>
 
@@ -16,6 +17,32 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+// Parses a list of CPUs like "0-3,8,10-11"
+static std::vector<unsigned> parseCpuList(const std::string &list) {
+    std::vector<unsigned> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos)
+            end = list.size();
+        std::string range = list.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        int first = -1, last = -1;
+        try {
+            first = std::stoi(range.substr(0, dash));
+            last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        } catch (...) {
+        }
+        if (first < 0 || last < first)
+            THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AFFINITY
+                               << ". Expected list of CPUs like 0-3,8";
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(static_cast<unsigned>(cpu));
+        pos = end + 1;
+    }
+    return cpus;
+}
+
 void Config::readProperties(const std::map<std::string, std::string> &prop) {
     for (auto& kvp : prop) {
         std::string key = kvp.first;
@@ -27,6 +54,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_THREAD
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_THREADS_NUM) {
+            int threads = -1;
+            try {
+                threads = std::stoi(val);
+            } catch (...) {
+            }
+            if (threads < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
+                                   << ". Expected only non-negative number of threads";
+            threadsNum = threads;
+        } else if (key == PluginConfigParams::KEY_CPU_AFFINITY) {
+            cpuAffinity = parseCpuList(val);
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = std::stoi(val);
             // zero and any negative value will be treated
@@ -52,6 +91,73 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO) memoryPolicy.hugePages = HugePagesMode::None;
+            else if (val == PluginConfigParams::YES) memoryPolicy.hugePages = HugePagesMode::Transparent;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_EXPLICIT) memoryPolicy.hugePages = HugePagesMode::Explicit;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only YES/NO/" << PluginConfigParams::CPU_HUGE_PAGES_EXPLICIT;
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_NODE) {
+            if (val == PluginConfigParams::NO) {
+                memoryPolicy.numaNode = MemoryPolicy::NUMA_FIRST_TOUCH;
+            } else if (val == PluginConfigParams::CPU_NUMA_LOCAL) {
+                memoryPolicy.numaNode = MemoryPolicy::NUMA_LOCAL;
+            } else {
+                int node = -1;
+                try {
+                    node = std::stoi(val);
+                } catch (...) {
+                }
+                if (node < 0)
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_NODE
+                                       << ". Expected only NO/" << PluginConfigParams::CPU_NUMA_LOCAL
+                                       << " or non-negative node id";
+                memoryPolicy.numaNode = node;
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
+            int streams = 0;
+            try {
+                streams = std::stoi(val);
+            } catch (...) {
+            }
+            if (streams < 1)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
+                                   << ". Expected only positive integer number of streams";
+            throughputStreams = streams;
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_STREAMS) {
+            if (val == PluginConfigParams::YES) numaStreams = true;
+            else if (val == PluginConfigParams::NO) numaStreams = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_STREAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_REPLICAS) {
+            if (val == PluginConfigParams::CPU_WEIGHTS_PER_NODE) weightsPerNode = true;
+            else if (val == PluginConfigParams::CPU_WEIGHTS_SINGLE) weightsPerNode = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_REPLICAS
+                                   << ". Expected only " << PluginConfigParams::CPU_WEIGHTS_PER_NODE
+                                   << "/" << PluginConfigParams::CPU_WEIGHTS_SINGLE;
+        } else if (key == PluginConfigParams::KEY_CPU_RELEASE_WEIGHTS) {
+            if (val == PluginConfigParams::YES) releaseWeights = true;
+            else if (val == PluginConfigParams::NO) releaseWeights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RELEASE_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WORKSPACE_GROUP) {
+            workspaceGroup = val;
+        } else if (key == PluginConfigParams::KEY_CPU_LOW_LATENCY) {
+            if (val == PluginConfigParams::YES) lowLatency = true;
+            else if (val == PluginConfigParams::NO) lowLatency = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LOW_LATENCY
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_FOLD_CONSTANTS) {
+            if (val == PluginConfigParams::YES) foldConstants = true;
+            else if (val == PluginConfigParams::NO) foldConstants = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_FOLD_CONSTANTS
+                                   << ". Expected only YES/NO";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -7,15 +7,27 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <ie_memory_policy.hpp>
 
 namespace MKLDNNPlugin {
 
 struct Config {
     bool useThreadBinding = true;
+    int threadsNum = 0;
+    std::vector<unsigned> cpuAffinity;
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     int batchLimit = 0;
+    InferenceEngine::MemoryPolicy memoryPolicy;
+    int throughputStreams = 1;
+    bool numaStreams = false;
+    bool weightsPerNode = true;
+    bool releaseWeights = false;
+    std::string workspaceGroup;
+    bool lowLatency = false;
+    bool foldConstants = true;
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
@@ -305,6 +305,49 @@ void OpenMpManager::bindOpenMpThreads(int env_cores) {
     }
 }
 
+std::vector<unsigned> OpenMpManager::getAvailableCores(int numaNode) {
+    OpenMpManager &openMpManager = getInstance();
+
+    cpu_set_t nodeSet;
+    if (numaNode >= 0 && !openMpManager.getNumaNodeCpuSet(numaNode, &nodeSet))
+        return {};
+
+    std::vector<unsigned> cores;
+    unsigned numberOfProcessors = openMpManager.collection.getNumberOfProcessors();
+    for (unsigned processorId = 0; processorId < numberOfProcessors; processorId++) {
+        if (!CPU_ISSET(processorId, &openMpManager.currentCoreSet))
+            continue;
+        if (numaNode >= 0 && !CPU_ISSET(processorId, &nodeSet))
+            continue;
+        cores.push_back(processorId);
+    }
+    return cores;
+}
+
+void OpenMpManager::bindOpenMpThreadsToCpus(const std::vector<unsigned> &cpus) {
+    if (cpus.empty())
+        return;
+
+    omp_set_num_threads(static_cast<int>(cpus.size()));
+    #pragma omp parallel
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[omp_get_thread_num() % cpus.size()], &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+}
+
+void OpenMpManager::unbindOpenMpThreads() {
+    OpenMpManager &openMpManager = getInstance();
+
+    omp_set_num_threads(CPU_COUNT(&openMpManager.currentCpuSet));
+    #pragma omp parallel
+    {
+        sched_setaffinity(0, sizeof(openMpManager.currentCpuSet), &openMpManager.currentCpuSet);
+    }
+}
+
 int OpenMpManager::getOpenMpThreadNumber() {
     OpenMpManager &openMpManager = getInstance();
 
@@ -327,6 +370,36 @@ void OpenMpManager::getCurrentCpuSet() {
     }
 }
 
+// Node CPUs are listed as ranges, e.g. "0-17,36-53"
+bool OpenMpManager::getNumaNodeCpuSet(int numaNode, cpu_set_t *set) {
+    CPU_ZERO(set);
+    std::ifstream cpuList("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist");
+    std::string ranges;
+    if (!(cpuList >> ranges))
+        return false;
+
+    size_t pos = 0;
+    while (pos < ranges.size()) {
+        size_t end = ranges.find(',', pos);
+        if (end == std::string::npos)
+            end = ranges.size();
+        std::string range = ranges.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        try {
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &currentCpuSet))
+                    CPU_SET(cpu, set);
+            }
+        } catch (...) {
+            return false;
+        }
+        pos = end + 1;
+    }
+    return CPU_COUNT(set) > 0;
+}
+
 void OpenMpManager::getDefaultCpuSet(cpu_set_t *defaultCpuSet) {
     CPU_ZERO(defaultCpuSet);
     unsigned numberOfProcessors = collection.getNumberOfProcessors();
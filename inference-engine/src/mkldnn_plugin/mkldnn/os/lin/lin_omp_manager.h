@@ -138,6 +138,24 @@ public:
 
     static bool isMajorThread(int currentThread);
 
+    /**
+     * @brief Returns available CPUs with one CPU per physical core
+     * @param numaNode restricts the list to the cores of the node, all nodes if negative
+     */
+    static std::vector<unsigned> getAvailableCores(int numaNode = -1);
+
+    /**
+     * @brief Sets the size of the OpenMP team of the calling thread to the number of CPUs
+     * and pins i-th thread of the team to the i-th CPU of the list
+     */
+    static void bindOpenMpThreadsToCpus(const std::vector<unsigned> &cpus);
+
+    /**
+     * @brief Restores the default size of the OpenMP team of the calling thread
+     * and allows its threads to run on any available CPU
+     */
+    static void unbindOpenMpThreads();
+
 private:
     Collection &collection;
 
@@ -164,6 +182,8 @@ private:
 
     void getCurrentCoreSet();
 
+    bool getNumaNodeCpuSet(int numaNode, cpu_set_t *set);
+
     void selectAllCoreCpus(cpu_set_t *set, unsigned physicalCoreId);
 
     unsigned getPhysicalCoreId(unsigned logicalCoreId);
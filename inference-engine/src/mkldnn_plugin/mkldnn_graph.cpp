@@ -7,9 +7,11 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <chrono>
 #include <caseless.hpp>
 
 #include "mkldnn_graph.h"
@@ -21,9 +23,11 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn/omp_manager.h"
 #include <omp.h>
+#include <ie_parallel.hpp>
 #include <graph_tools.hpp>
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include "ie_algorithm.hpp"
+#include "ie_util_internal.hpp"
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
@@ -41,167 +45,264 @@ using namespace MKLDNNPlugin::cpu;
 using namespace InferenceEngine;
 using namespace InferenceEngine::MKLDNNPlugin;
 
-void BindThreads(mkldnn::engine eng) {
-    static bool alreadyBind = false;
-    if (!alreadyBind) {
-        int env_cores = 0;
-        if (getenv("OMP_NUM_THREADS") != nullptr) {
-            try {
-                env_cores = std::stoi(std::string(getenv("OMP_NUM_THREADS")));
-            } catch (...) {
-                env_cores = 0;
-            }
+namespace {
+// Settings the thread team of a thread was configured with
+struct ThreadsSettings {
+    bool configured = false;
+    int threadsNum = 0;
+    bool useThreadBinding = false;
+    std::vector<unsigned> cpuAffinity;
+};
+}  // namespace
+
+// The thread team belongs to the calling thread, so it's configured by the thread which creates the graph
+// and again by any other thread which runs the graph (e.g. an executor shared by several networks).
+// Graphs with the same settings run on the same thread don't reconfigure the team.
+void MKLDNNGraph::BindThreads() {
+    static thread_local ThreadsSettings applied;
+    if (applied.configured && applied.threadsNum == config.threadsNum &&
+        applied.useThreadBinding == config.useThreadBinding && applied.cpuAffinity == config.cpuAffinity)
+        return;
+    bool wasBound = applied.configured;
+    applied.configured = true;
+    applied.threadsNum = config.threadsNum;
+    applied.useThreadBinding = config.useThreadBinding;
+    applied.cpuAffinity = config.cpuAffinity;
+
+#if IE_THREAD != IE_THREAD_OMP
+    // mkl-dnn primitives always run on OpenMP threads configured below, but plugin nodes and extension layers
+    // run on the backend of ie_parallel.hpp, which gets the thread count too. 0 removes the limit.
+    parallel_set_num_threads(config.threadsNum);
+#endif
+
+    int env_cores = 0;
+    if (getenv("OMP_NUM_THREADS") != nullptr) {
+        try {
+            env_cores = std::stoi(std::string(getenv("OMP_NUM_THREADS")));
+        } catch (...) {
+            env_cores = 0;
         }
+    }
 #if !(defined(__APPLE__) || defined(_WIN32))
-        OpenMpManager::setGpuDisabled();
-        OpenMpManager::bindOpenMpThreads(env_cores);
+    // Threads beyond the list of CPUs reuse its CPUs in the same order
+    auto bindTo = [&](const std::vector<unsigned> &cpus) {
+        if (cpus.empty())
+            return;
+        std::vector<unsigned> threadCpus;
+        size_t threads = config.threadsNum > 0 ? config.threadsNum : cpus.size();
+        for (size_t i = 0; i < threads; i++)
+            threadCpus.push_back(cpus[i % cpus.size()]);
+        OpenMpManager::bindOpenMpThreadsToCpus(threadCpus);
+    };
+
+    if (!config.cpuAffinity.empty()) {
+        bindTo(config.cpuAffinity);
+        return;
+    }
+    if (wasBound)
+        OpenMpManager::unbindOpenMpThreads();
+
+    if (config.useThreadBinding) {
+        if (config.threadsNum > 0) {
+            bindTo(OpenMpManager::getAvailableCores());
+        } else {
+            OpenMpManager::setGpuDisabled();
+            OpenMpManager::bindOpenMpThreads(env_cores);
+        }
+    } else if (config.threadsNum > 0) {
+        omp_set_num_threads(config.threadsNum);
+    }
 #else
-        int num_cores = env_cores == 0 ? OpenMpManager::getOpenMpThreadNumber() : env_cores;
-        omp_set_num_threads(num_cores);
+    int num_cores = config.threadsNum > 0 ? config.threadsNum
+                                          : env_cores == 0 ? OpenMpManager::getOpenMpThreadNumber() : env_cores;
+    omp_set_num_threads(num_cores);
 #endif
+}
 
-        alreadyBind = true;
+namespace {
+
+// Stores the wall time of its scope in microseconds
+class LoadStageTimer {
+public:
+    explicit LoadStageTimer(uint64_t &time) : time(time), start(std::chrono::steady_clock::now()) {}
+    ~LoadStageTimer() {
+        time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
     }
-}
+
+private:
+    uint64_t &time;
+    std::chrono::steady_clock::time_point start;
+};
+
+}  // namespace
 
 void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     if (IsReady()) {
         ForgetGraphData();
     }
 
-    if (config.useThreadBinding) BindThreads(eng);
+    BindThreads();
 
-    // go over the inputs and create input primitives
-    InputsDataMap inputs;
-    network.getInputsInfo(inputs);
-    if (inputs.empty()) {
-        THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: No inputs for the topology";
+    // Graph is created by the thread which executes it, so local node is resolved once here
+    // and all allocations of the graph are placed on the same node
+    if (config.memoryPolicy.numaNode == MemoryPolicy::NUMA_LOCAL) {
+        config.memoryPolicy.numaNode = getCurrentNumaNode();
+        blobAllocator = CreateSystemAllocator(config.memoryPolicy);
     }
 
-    for (auto input : inputs) {
-        MKLDNNNodePtr inputNode;
-        auto inputLayer = input.second->getInputData()->getCreatorLayer().lock();
-        if (!inputLayer) {
-            // For v1 parser
-            inputLayer.reset(new CNNLayer({input.second->getInputData()->getName(),
-                                           "Input",
-                                           input.second->getInputData()->getPrecision()}));
-
-            inputLayer->outData.push_back(input.second->getInputData());
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNN_LOAD_PARSE)
+        LoadStageTimer timer(loadTimes[LoadParse]);
+        // go over the inputs and create input primitives
+        InputsDataMap inputs;
+        network.getInputsInfo(inputs);
+        if (inputs.empty()) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: No inputs for the topology";
         }
 
-        inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(inputLayer, getEngine(), extMgr));
+        for (auto input : inputs) {
+            MKLDNNNodePtr inputNode;
+            auto inputLayer = input.second->getInputData()->getCreatorLayer().lock();
+            if (!inputLayer) {
+                // For v1 parser
+                inputLayer.reset(new CNNLayer({input.second->getInputData()->getName(),
+                                               "Input",
+                                               input.second->getInputData()->getPrecision()}));
 
-        graphNodes.push_back(inputNode);
-        inputNodes[input.first] = inputNode;
-        std::vector<ParsedLayer> queueLayers;
+                inputLayer->outData.push_back(input.second->getInputData());
+            }
 
-        for (const auto &layer : input.second->getInputData()->getInputTo()) {
-            queueLayers.push_back({inputNode, layer.second, 0});
-        }
+            inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(inputLayer, getEngine(), extMgr));
 
-        while (!queueLayers.empty()) {
-            ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
-            queueLayers.erase(queueLayers.begin());
-        }
+            graphNodes.push_back(inputNode);
+            inputNodes[input.first] = inputNode;
+            std::vector<ParsedLayer> queueLayers;
 
-        // Loading mean images
-        MKLDNNDims outDims(inputNode->getChildEdgeAt(0)->getDims());
-        if (inputs.find(input.first) != inputs.end()) {
-            InputInfo::Ptr ii = inputs[input.first];
-            if (ii && ii->getPreProcess().getNumberOfChannels()) {
-                _meanImages[input.first].Load(outDims, ii);
+            for (const auto &layer : input.second->getInputData()->getInputTo()) {
+                queueLayers.push_back({inputNode, layer.second, 0});
             }
-        }
-    }
 
-    auto allInputs = CNNNetGetAllInputLayers(network);
-    for (auto input : allInputs) {
-        auto isRealInput = std::find_if(std::begin(inputs), std::end(inputs), [&](InputsDataMap::value_type& inputInfo){
-            return inputInfo.second->getInputData()->getName() == input->name;
-        });
-        if (isRealInput != std::end(inputs)) {
-            continue;
+            while (!queueLayers.empty()) {
+                ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
+                queueLayers.erase(queueLayers.begin());
+            }
+
+            // Loading mean images
+            MKLDNNDims outDims(inputNode->getChildEdgeAt(0)->getDims());
+            if (inputs.find(input.first) != inputs.end()) {
+                InputInfo::Ptr ii = inputs[input.first];
+                if (ii && ii->getPreProcess().getNumberOfChannels()) {
+                    _meanImages[input.first].Load(outDims, ii);
+                }
+            }
         }
 
-        MKLDNNNodePtr inputNode;
-        CaselessEq<std::string> eq;
+        auto allInputs = CNNNetGetAllInputLayers(network);
+        for (auto input : allInputs) {
+            auto isRealInput = std::find_if(std::begin(inputs), std::end(inputs),
+                                            [&](InputsDataMap::value_type& inputInfo) {
+                return inputInfo.second->getInputData()->getName() == input->name;
+            });
+            if (isRealInput != std::end(inputs)) {
+                continue;
+            }
 
-        if (eq(input->type, "Memory")) {
-            auto memoryId = input->GetParamAsString("id");
-            CNNLayerPtr layer(new CNNLayer({input->name + "/id=" + memoryId, "MemoryInput", input->precision}));
-            layer->params = input->params;
-            layer->outData = input->outData;
+            MKLDNNNodePtr inputNode;
+            CaselessEq<std::string> eq;
 
-            inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(layer, getEngine(), extMgr));
-        } else if (eq(input->type, "Const")) {
-            inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(input, getEngine(), extMgr));
-        }
-        graphNodes.push_back(inputNode);
+            if (eq(input->type, "Memory")) {
+                auto memoryId = input->GetParamAsString("id");
+                CNNLayerPtr layer(new CNNLayer({input->name + "/id=" + memoryId, "MemoryInput", input->precision}));
+                layer->params = input->params;
+                layer->outData = input->outData;
 
-        std::vector<ParsedLayer> queueLayers;
-        size_t count_out = 0;
-        for (auto &&outData : input->outData) {
-            for (auto &&layer : outData->getInputTo()) {
-                queueLayers.push_back({inputNode, layer.second, count_out});
+                inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(layer, getEngine(), extMgr));
+            } else if (eq(input->type, "Const")) {
+                inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(input, getEngine(), extMgr));
+            }
+            graphNodes.push_back(inputNode);
+
+            std::vector<ParsedLayer> queueLayers;
+            size_t count_out = 0;
+            for (auto &&outData : input->outData) {
+                for (auto &&layer : outData->getInputTo()) {
+                    queueLayers.push_back({inputNode, layer.second, count_out});
+                }
+                count_out++;
+            }
+
+            while (!queueLayers.empty()) {
+                ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
+                queueLayers.erase(queueLayers.begin());
             }
-            count_out++;
         }
 
-        while (!queueLayers.empty()) {
-            ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
-            queueLayers.erase(queueLayers.begin());
+        std::map<std::string, DataPtr> output;
+        network.getOutputsInfo(output);
+
+        for (auto it = output.begin(); it != output.end(); it++) {
+            MKLDNNNodePtr node = FindNodeWithName((*it).second->getCreatorLayer().lock()->name);
+            if (!node)
+                THROW_IE_EXCEPTION << "Cannot find output layer " << (*it).second->getCreatorLayer().lock()->name;
+
+            std::string name = "out_" + (*it).first;
+
+            CNNLayerPtr layer(new CNNLayer({name,
+                                            "Output",
+                                            (*it).second->getCreatorLayer().lock()->outData[0]->getPrecision()}));
+            layer->insData.push_back((*it).second);
+            MKLDNNNodePtr outputLayer(new MKLDNNInputNode(layer, getEngine()));
+            MKLDNNEdgePtr edgePtr(new MKLDNNEdge(node, outputLayer));
+            graphEdges.push_back(edgePtr);
+            outputLayer->addEdge(edgePtr, 0, node->getChildEdges().size());
+            graphNodes.push_back(outputLayer);
+            outputNodes.push_back(outputLayer);
         }
     }
 
-    std::map<std::string, DataPtr> output;
-    network.getOutputsInfo(output);
-
-    for (auto it = output.begin(); it != output.end(); it++) {
-        MKLDNNNodePtr node = FindNodeWithName((*it).second->getCreatorLayer().lock()->name);
-        if (!node)
-            THROW_IE_EXCEPTION << "Cannot find output layer " << (*it).second->getCreatorLayer().lock()->name;
-
-        std::string name = "out_" + (*it).first;
-
-        CNNLayerPtr layer(new CNNLayer({name,
-                                        "Output",
-                                        (*it).second->getCreatorLayer().lock()->outData[0]->getPrecision()}));
-        layer->insData.push_back((*it).second);
-        MKLDNNNodePtr outputLayer(new MKLDNNInputNode(layer, getEngine()));
-        MKLDNNEdgePtr edgePtr(new MKLDNNEdge(node, outputLayer));
-        graphEdges.push_back(edgePtr);
-        outputLayer->addEdge(edgePtr, 0, node->getChildEdges().size());
-        graphNodes.push_back(outputLayer);
-        outputNodes.push_back(outputLayer);
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNN_LOAD_OPTIMIZE)
+        LoadStageTimer timer(loadTimes[LoadOptimize]);
+        MKLDNNGraphOptimizer optimizer;
+        optimizer.Optimize(*this);
+        SortTopologically();
     }
 
-    MKLDNNGraphOptimizer optimizer;
-    optimizer.Optimize(*this);
-    SortTopologically();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNN_LOAD_SELECT_DESCRIPTORS)
+        LoadStageTimer timer(loadTimes[LoadSelectDescriptors]);
+        InitNodes();
 
-    InitNodes();
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+        InitEdges();
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+        SortTopologically();
     }
-    InitEdges();
-
-    SortTopologically();
 
-    Allocate();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNN_LOAD_ALLOCATE)
+        LoadStageTimer timer(loadTimes[LoadAllocate]);
+        Allocate();
+    }
 
-    CreatePrimitives();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNN_LOAD_CREATE_PRIMITIVES)
+        LoadStageTimer timer(loadTimes[LoadCreatePrimitives]);
+        CreatePrimitives();
 
-    for (auto &graphNode : graphNodes) {
-        graphNode->cleanup();
-    }
+        for (auto &graphNode : graphNodes) {
+            graphNode->cleanup();
+        }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
-        graphNode->execute(stream);
+        // Constant data is never placed in the workspace group, so other graphs of the group may run meanwhile
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+            graphNode->execute(stream);
+        }
     }
 
     status = Ready;
@@ -421,81 +522,70 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
-void MKLDNNGraph::AllocateWithReuse() {
-    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
-
-    // detect edge clasters which are view on one.
-    for (auto &edge : graphEdges) {
-        MKLDNNEdgePtr par = (edge->getStatus() == MKLDNNEdge::Status::NotAllocated)
-                            ? edge->getSharedEdge()
-                            : nullptr;
-        if (par) {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == par) {
-                        claster.push_back(edge);
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found) edge_clasters.push_back({par, edge});
+std::vector<std::vector<MKLDNNEdgePtr>> MKLDNNGraph::ClusterEdges() {
+    // Edges are joined with the edges they share memory with in a union-find,
+    // so views of views end up in the same claster.
+    std::vector<MKLDNNEdgePtr> edges(graphEdges);
+    std::unordered_map<const MKLDNNEdge *, int> edgeIndex;
+    for (int i = 0; i < edges.size(); i++) edgeIndex[edges[i].get()] = i;
+
+    std::vector<int> root(edges.size());
+    for (int i = 0; i < root.size(); i++) root[i] = i;
+    auto findRoot = [&](int i) {
+        while (root[i] != i) {
+            root[i] = root[root[i]];
+            i = root[i];
+        }
+        return i;
+    };
 
+    for (int i = 0; i < graphEdges.size(); i++) {
+        if (graphEdges[i]->getStatus() != MKLDNNEdge::Status::NotAllocated) continue;
+
+        MKLDNNEdgePtr par = graphEdges[i]->getSharedEdge();
+        auto found = edgeIndex.find(par.get());
+        int j;
+        if (found == edgeIndex.end()) {
+            j = static_cast<int>(edges.size());
+            edges.push_back(par);
+            root.push_back(j);
+            edgeIndex[par.get()] = j;
         } else {
-            bool found = false;
-            for (auto &claster : edge_clasters) {
-                for (auto &element : claster) {
-                    if (element == edge) {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (!found) edge_clasters.push_back({edge});
+            j = found->second;
         }
-    }
-
-    //======= WA. getSharedEdge() returns not identical edges ============
-    //  Will try to merge clasters with matched edges
-    for (auto &edge : graphEdges) {
-        std::vector<decltype(&edge_clasters[0])> to_merge;
-
-        for (auto &claster : edge_clasters)
-            if (std::find(claster.begin(), claster.end(), edge) != claster.end())
-                to_merge.push_back(&claster);
-
-        if (to_merge.size() > 1) {
-            // Merge clasters
-            auto base_classter = to_merge[0];
-            for (int i = 1; i < to_merge.size(); i++) {
-                base_classter->insert(base_classter->end(),
-                                      to_merge[i]->begin(), to_merge[i]->end());
-                to_merge[i]->clear();
-            }
 
-            // remove duplicates in merged claster
-            std::sort(base_classter->begin(), base_classter->end());
-            base_classter->erase(std::unique(base_classter->begin(), base_classter->end()),
-                    base_classter->end() );
+        int a = findRoot(i), b = findRoot(j);
+        if (a != b) root[std::max(a, b)] = std::min(a, b);
+    }
 
-            // remove empty clasters
-            edge_clasters.erase(std::remove_if(edge_clasters.begin(), edge_clasters.end(),
-                    [] ( std::vector<MKLDNNEdgePtr> &cls) { return cls.empty(); }),
-                    edge_clasters.end());
+    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
+    std::vector<int> clasterOf(edges.size(), -1);
+    for (int i = 0; i < edges.size(); i++) {
+        int r = findRoot(i);
+        if (clasterOf[r] == -1) {
+            clasterOf[r] = static_cast<int>(edge_clasters.size());
+            edge_clasters.emplace_back();
         }
+        edge_clasters[clasterOf[r]].push_back(edges[i]);
     }
-    //======= End of WA ============
+    return edge_clasters;
+}
+
+void MKLDNNGraph::AllocateWithReuse() {
+    std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters = ClusterEdges();
 
     const int alignment = 16;  // 64 bytes or 16 floats
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    std::vector<bool> constClasters(edge_clasters.size());
+    std::vector<bool> sharedClasters(edge_clasters.size());
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
             int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // A shape only consumer doesn't read the data, so it doesn't keep the memory alive
+            int e_finish = edge->getChild()->isShapeOnly() ? e_start : edge->getChild()->execIndex;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -522,27 +612,57 @@ void MKLDNNGraph::AllocateWithReuse() {
             isConst |= edge->getParent()->getType() == MemoryInput;
         }
 
+        constClasters[i] = isConst;
+        // Other graphs of the workspace group overwrite the shared memory between infer calls,
+        // so only data which doesn't live longer than one infer call can be placed there
+        sharedClasters[i] = workspaceGroup && !(isConst | isOutput | isInput);
         if (isInput  | isConst) box.start = 0;
         if (isOutput | isConst) box.finish = -1;
 
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = memSolver.solve() * alignment;
+    std::vector<MemorySolver::Box> privateBoxes, sharedBoxes;
+    for (int i = 0; i < boxes.size(); i++)
+        (sharedClasters[i] ? sharedBoxes : privateBoxes).push_back(boxes[i]);
 
-    memWorkspace.reset(new MKLDNNMemory(eng));
+    MemorySolver memSolver(privateBoxes), sharedSolver(sharedBoxes);
+    // Compilation is a one time cost, so spend it on the tightest packing
+    size_t total_size = memSolver.solve(MemorySolver::Strategy::BEST) * alignment;
+    size_t shared_size = sharedSolver.solve(MemorySolver::Strategy::BEST) * alignment;
+
+    activationsNoReuse = 0;
+    constantsSize = 0;
+    for (int i = 0; i < boxes.size(); i++) {
+        activationsNoReuse += boxes[i].size * alignment * sizeof(float);
+        if (constClasters[i]) constantsSize += boxes[i].size * alignment * sizeof(float);
+    }
+    workspaceLowerBound = (memSolver.maxDepth() + sharedSolver.maxDepth()) * alignment * sizeof(float);
+
+    memWorkspace.reset(new MKLDNNMemory(eng, config.memoryPolicy));
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, total_size}, Layout::NC)));
     float* workspace_ptr = static_cast<float*>(memWorkspace->GetData());
 
+    float* shared_ptr = nullptr;
+    sharedWorkspaceSize = shared_size * sizeof(float);
+    if (workspaceGroup) {
+        workspaceGroup->reserve(sharedWorkspaceSize);
+        // The memory may be grown by another graph meanwhile, then the stale generation makes Infer rebind the edges
+        sharedGeneration = workspaceGroup->generation();
+        shared_ptr = static_cast<float*>(workspaceGroup->data());
+        sharedBase = reinterpret_cast<uint8_t *>(shared_ptr);
+    }
+
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int offset = memSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in float
+                if (sharedClasters[i])
+                    edge->allocate(shared_ptr + sharedSolver.getOffset(i) * alignment);  // alignment in float
+                else
+                    edge->allocate(workspace_ptr + memSolver.getOffset(i) * alignment);
                 count++;
             }
         }
@@ -550,6 +670,17 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::BindSharedWorkspace() {
+    if (!workspaceGroup || workspaceGroup->generation() == sharedGeneration)
+        return;
+
+    // The group memory was reallocated by a graph which joined the group later
+    sharedBase = static_cast<uint8_t *>(workspaceGroup->data());
+    for (auto &memory : sharedMemories)
+        memory.first->GetPrimitivePtr()->set_data_handle(sharedBase + memory.second);
+    sharedGeneration = workspaceGroup->generation();
+}
+
 void MKLDNNGraph::Allocate() {
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
@@ -564,16 +695,29 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    // Remember edges placed in the shared memory including views on them, to move them when it's reallocated
+    if (workspaceGroup) {
+        for (auto& edge : graphEdges) {
+            auto *ptr = static_cast<uint8_t *>(edge->getMemory().GetData());
+            if (sharedBase != nullptr && ptr >= sharedBase && ptr < sharedBase + sharedWorkspaceSize)
+                sharedMemories.emplace_back(edge->getMemoryPtr(), static_cast<size_t>(ptr - sharedBase));
+        }
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     for (auto& node : graphNodes) {
+        node->setMemoryPolicy(config.memoryPolicy);
+        node->setWeightsCache(weightsCache);
         node->createPrimitive();
+        node->GetProfilingTask().details = node->getPrimitiveDescriptorType();
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+size_t MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_PUSH_INPUT)
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
@@ -582,9 +726,12 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr)
-        input->second->getChildEdgeAt(0)->getMemory().SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                MKLDNNMemory::Convert(in->getTensorDesc().getLayout()), ext_data_ptr, in->byteSize(), false);
+        size_t copied = 0;
+        if (ext_data_ptr != inter_data_ptr) {
+            input->second->getChildEdgeAt(0)->getMemory().SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
+                    MKLDNNMemory::Convert(in->getTensorDesc().getLayout()), ext_data_ptr, in->byteSize(), false);
+            copied = in->byteSize();
+        }
 
         // todo: make sure 'name' exists in this map...
         if (_meanImages.find(name) != _meanImages.end()) {
@@ -594,16 +741,19 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
         }
+        return copied;
     } else {
         THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
     }
 }
 
-void MKLDNNGraph::PullOutputData(BlobMap &out) {
+void MKLDNNGraph::PullOutputData(BlobMap &out, size_t *copiedBytes) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_PULL_OUTPUTS)
 
-    for (MKLDNNNodePtr &node : outputNodes) {
+    for (size_t i = 0; i < outputNodes.size(); i++) {
+        MKLDNNNodePtr &node = outputNodes[i];
         // remove out_ from node name
         std::string name = node->getName().substr(4);
         const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
@@ -634,7 +784,11 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            if (copiedBytes)
+                copiedBytes[i] = 0;
+            continue;
+        }
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
@@ -644,6 +798,8 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
 
         memcpy(ext_blob_ptr, intr_blob_ptr, size_to_copy);
+        if (copiedBytes)
+            copiedBytes[i] = size_to_copy;
     }
 }
 
@@ -777,25 +933,38 @@ void dump_as_bitmaps(const std::string name, const float* data,
 }
 #endif
 
-void MKLDNNGraph::Infer(int batch) {
+void MKLDNNGraph::Infer(int batch, PerfCount *nodesCounters) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    BindThreads();
+
+    // Other graphs of the workspace group can't be executed till the end of the call
+    MKLDNNWorkspaceGroup::Holder holder(workspaceGroup, this);
+    BindSharedWorkspace();
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
 #ifdef DEBUG_DUMP_NEW_FOLDER_PER_INFER
         static int folderIdx = 0;
         folderIdx++;
 #endif
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
-
+    auto executeNode = [&](const MKLDNNNodePtr &node) {
         if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            node->setDynamicBatchLim(batch);
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+        if (!node->isConstant()) {
+            IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+            node->execute(stream);
+        }
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        // Counters cost a clock read and atomic updates per node, so they are updated only if requested
+        {
+            PerfHelper perf(graphNodes[i]->PerfCounter(), nodesCounters ? &nodesCounters[i] : nullptr, true,
+                            config.collectPerfCounters);
+            executeNode(graphNodes[i]);
         }
 
 #ifdef DEBUG_DUMP_PATH
@@ -958,14 +1127,14 @@ void MKLDNNGraph::SortTopologically() {
     graphNodes.assign(sorted.begin(), sorted.end());
 }
 
-void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
-    std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
-            getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
+void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap,
+                              const PerfCount *nodesCounters) const {
+    std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&,
+                       const PerfCount &)>
+            getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node,
+                                const PerfCount &counter) {
         InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
-        // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
-                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        counter.fill(pc);
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
@@ -973,21 +1142,60 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         node->typeStr.copy(pc.layer_type, layerTypeLen, 0);
 
         for (auto& fusedNode : node->fusedWith) {
-            getPerfMapFor(perfMap, fusedNode);
+            getPerfMapFor(perfMap, fusedNode, fusedNode->PerfCounter());
         }
 
         for (auto& mergedWith : node->mergedWith) {
-            getPerfMapFor(perfMap, mergedWith);
+            getPerfMapFor(perfMap, mergedWith, mergedWith->PerfCounter());
         }
     };
 
     for (int i = 1; i < graphNodes.size(); i++) {
-        getPerfMapFor(perfMap, graphNodes[i]);
+        getPerfMapFor(perfMap, graphNodes[i], nodesCounters ? nodesCounters[i] : graphNodes[i]->PerfCounter());
     }
 }
 
+void MKLDNNGraph::GetMemoryInfo(InferenceEngine::MemoryInfo &info,
+                                std::unordered_set<const MKLDNNMemory *> &countedWeights) const {
+    // All copies of the graph have the same layout, the first one gives the breakdown by layers
+    bool addLayers = info.layers.empty();
+
+    for (auto &node : graphNodes) {
+        MemoryInfo::LayerMemoryInfo layer;
+        for (auto &memory : node->internalBlobMemory) {
+            layer.weights += memory->GetAllocatedSize();
+            if (countedWeights.insert(memory.get()).second) {
+                info.weights += memory->GetAllocatedSize();
+                info.allocatorOverhead += memory->GetReservedSize() - memory->GetAllocatedSize();
+            }
+        }
+
+        // Several edges of one output port are views on the same data
+        std::unordered_set<const void *> outputs;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto &memory = node->getChildEdgeAt(i)->getMemoryPtr();
+            if (memory && outputs.insert(memory->GetData()).second)
+                layer.outputs += memory->GetSize();
+        }
+
+        if (addLayers && (layer.weights || layer.outputs))
+            info.layers[node->getName()] = layer;
+    }
+
+    if (memWorkspace) {
+        // Memory of a workspace group is reported as the part this graph needs
+        info.workspace = memWorkspace->GetAllocatedSize() + sharedWorkspaceSize;
+        info.allocatorOverhead += memWorkspace->GetReservedSize() - memWorkspace->GetAllocatedSize();
+    }
+    info.activationsNoReuse = activationsNoReuse;
+    info.workspaceLowerBound = workspaceLowerBound;
+    info.constants = constantsSize;
+    info.graphCopies++;
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
+    blobAllocator = CreateSystemAllocator(config.memoryPolicy);
 }
 
 void MKLDNNGraph::setProperty(const std::map<std::string, std::string>& properties) {
@@ -1061,12 +1269,36 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
 }
 
+// Splits the cores of a NUMA node (of the whole machine if node is negative, or the cores given
+// by the affinity setting) evenly between the streams placed there
+static void SetStreamThreads(Config &streamCfg, int numaNode, int streamIdx, int streamsNum) {
+#if !(defined(__APPLE__) || defined(_WIN32))
+    std::vector<unsigned> cores = streamCfg.cpuAffinity;
+    if (cores.empty())
+        cores = OpenMpManager::getAvailableCores(numaNode);
+    if (cores.empty())
+        cores = OpenMpManager::getAvailableCores();
+    if (cores.empty())
+        return;
+
+    size_t first = cores.size() * streamIdx / streamsNum;
+    size_t last = std::max(cores.size() * (streamIdx + 1) / streamsNum, first + 1);
+    std::vector<unsigned> streamCores(cores.begin() + first, cores.begin() + last);
+    if (streamCfg.numaStreams || streamCfg.useThreadBinding || !streamCfg.cpuAffinity.empty()) {
+        streamCfg.cpuAffinity = streamCores;
+    } else if (streamCfg.threadsNum == 0) {
+        streamCfg.threadsNum = static_cast<int>(streamCores.size());
+    }
+#else
+    if (streamCfg.threadsNum == 0)
+        streamCfg.threadsNum = std::max(1, OpenMpManager::getOpenMpThreadNumber() / streamsNum);
+#endif
+}
+
 MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
-    graph.reset(new MKLDNNGraph());
-    graph->setConfig(cfg);
-
+                                     const MKLDNNExtensionManager::Ptr& extMgr) : nextStream(0), extensionManager(extMgr),
+                                                                                   spinWaitMicros(0) {
     if (cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(network)) {
@@ -1074,32 +1306,99 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
         }
     }
 
-    if (graph->getProperty().exclusiveAsyncRequests) {
-        ExecutorManager *executorManager = ExecutorManager::getInstance();
-        _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
+    // Exclusive requests of all networks are executed one by one, so there is nothing to run in parallel
+    int streamsNum = cfg.exclusiveAsyncRequests ? 1 : cfg.throughputStreams;
+    int nodesNum = cfg.numaStreams ? std::min(getNumaNodesCount(), streamsNum) : 1;
+
+    if (cfg.releaseWeights) {
+        // Weights of built-in weightable nodes are copied to their internal memory, all other layers
+        // (extensions, constants, deconvolution biases) may keep referencing their blobs after the graph is created.
+        // They get compact copies here, so the IR buffer isn't kept alive by the plugin.
+        details::CNNNetworkIterator i(&network);
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            if (!dynamic_cast<WeightableLayer *>(layer.get()) || dynamic_cast<DeconvolutionLayer *>(layer.get()))
+                detachLayerBlobs(*layer);
+            i++;
+        }
     }
 
-    // initialization in taskExecutor thread
-    auto task = std::make_shared<InferenceEngine::Task>([&]() {
-        graph->CreateGraph(network, extensionManager);
-    });
+    std::vector<MKLDNNWeightsCache::Ptr> weightsCaches;
+    if (streamsNum > 1) {
+        int replicas = cfg.weightsPerNode ? nodesNum : 1;
+        for (int i = 0; i < replicas; i++)
+            weightsCaches.push_back(std::make_shared<MKLDNNWeightsCache>());
+    }
+
+    for (int s = 0; s < streamsNum; s++) {
+        Stream stream;
+        int nodeIdx = s % nodesNum;
+        int streamsOnNode = streamsNum / nodesNum + (nodeIdx < streamsNum % nodesNum ? 1 : 0);
+
+        Config streamCfg = cfg;
+        if (cfg.numaStreams)
+            streamCfg.memoryPolicy.numaNode = nodeIdx;
+        if (streamsNum > 1)
+            SetStreamThreads(streamCfg, cfg.numaStreams ? nodeIdx : -1, s / nodesNum, streamsOnNode);
+
+        stream.graph.reset(new MKLDNNGraph());
+        stream.graph->setConfig(streamCfg);
+        if (!weightsCaches.empty())
+            stream.graph->setWeightsCache(weightsCaches[cfg.weightsPerNode ? nodeIdx : 0]);
+        if (!cfg.workspaceGroup.empty())
+            stream.graph->setWorkspaceGroup(MKLDNNWorkspaceGroup::get(cfg.workspaceGroup, s, streamCfg.memoryPolicy));
+
+        if (cfg.exclusiveAsyncRequests) {
+            ExecutorManager *executorManager = ExecutorManager::getInstance();
+            stream.executor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
+        } else if (s == 0) {
+            stream.executor = _taskExecutor;
+        } else {
+            stream.executor = std::make_shared<PriorityTaskExecutor>("CPUStream" + std::to_string(s));
+        }
+        // Requests of a stream are already serialized by its executor, so only exclusive requests
+        // which run sync tasks of different networks need a synchronizer in the low latency mode
+        if (!cfg.lowLatency || cfg.exclusiveAsyncRequests)
+            stream.synchronizer = s == 0 ? _taskSynchronizer : std::make_shared<TaskSynchronizer>();
+
+        // initialization in taskExecutor thread
+        auto task = std::make_shared<InferenceEngine::Task>([&]() {
+            stream.graph->CreateGraph(network, extensionManager);
+        });
+
+        stream.executor->startTask(task);
+        Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+
+        if (sts == Task::TS_ERROR) task->checkException();
+
+        streams.push_back(stream);
+    }
+    _taskExecutor = streams[0].executor;
 
-    _taskExecutor->startTask(task);
-    Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    if (cfg.lowLatency) {
+        // Callbacks are run inline by the stream threads
+        _callbackExecutor = nullptr;
+        spinWaitMicros = 1000;
+    }
 
-    if (sts == Task::TS_ERROR) task->checkException();
+    if (cfg.releaseWeights)
+        releaseNetworkBlobs(network);
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
-    if (graph)  // TODO: graph field cannot be empty
-        graph->setProperty(properties);
+    for (auto &stream : streams)
+        stream.graph->setProperty(properties);
 }
 
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
+    // Requests are distributed between streams in round-robin order
+    auto &stream = streams[nextStream++ % streams.size()];
+
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
-                                                                      _taskSynchronizer, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, stream.executor,
+                                                                      stream.synchronizer, _callbackExecutor);
+    asyncRequestImpl->SetSpinWait(spinWaitMicros);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -1108,10 +1407,35 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
     auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(syncRequestImpl.get());
     if (!mkldnnSyncRequest)
         THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
-    mkldnnSyncRequest->SetGraph(graph);
+    mkldnnSyncRequest->SetGraph(stream.graph);
+}
+
+void MKLDNNExecNetwork::GetMemoryInfo(InferenceEngine::MemoryInfo &info) {
+    info = MemoryInfo();
+    std::unordered_set<const MKLDNNMemory *> countedWeights;
+    for (auto &stream : streams)
+        stream.graph->GetMemoryInfo(info, countedWeights);
+
+    // Infer requests allocate their blobs in the precision of the network inputs and outputs
+    auto byteSize = [](const TensorDesc &desc) {
+        size_t size = desc.getPrecision().size();
+        for (auto dim : desc.getDims()) size *= dim;
+        return size;
+    };
+    for (auto &input : _networkInputs) {
+        TensorDesc desc = input.second->getTensorDesc();
+        desc.setPrecision(input.second->getInputPrecision());
+        info.requestIO += byteSize(desc);
+    }
+    BlobMap outputs;
+    streams[0].graph->getOutputBlobs(outputs);
+    for (auto &output : outputs)
+        info.requestIO += byteSize(output.second->getTensorDesc());
+
+    info.total = info.workspace * info.graphCopies + info.weights + info.allocatorOverhead;
 }
 
 MKLDNNExecNetwork::~MKLDNNExecNetwork() {
-    graph.reset();
+    streams.clear();
     extensionManager.reset();
 }
@@ -9,9 +9,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <unordered_set>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "mkldnn_memory.h"
+#include "mkldnn_weights_cache.h"
+#include "mkldnn_workspace_group.h"
 #include "config.h"
 #include "perf_count.h"
 #include "mkldnn_dims.h"
@@ -32,6 +36,7 @@ public:
     };
 
     MKLDNNGraph(): status(NotReady), eng(mkldnn::engine(mkldnn::engine::kind::cpu, 0)) {}
+    virtual ~MKLDNNGraph() = default;
 
     Status GetStatus() {
         return status;
@@ -42,6 +47,12 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    void setWeightsCache(const MKLDNNWeightsCache::Ptr &cache) {
+        weightsCache = cache;
+    }
+    void setWorkspaceGroup(const MKLDNNWorkspaceGroup::Ptr &group) {
+        workspaceGroup = group;
+    }
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
@@ -54,10 +65,14 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
+    // Returns the number of bytes copied from the blob to the graph memory, 0 if the blob already is
+    // the memory of the graph edge
+    size_t PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // copiedBytes - optional, i-th element gets the bytes copied to the blob of the i-th node of GetOutputNodes()
+    void PullOutputData(InferenceEngine::BlobMap &out, size_t *copiedBytes = nullptr);
 
-    void Infer(int batch = -1);
+    // nodesCounters - optional per request counters, i-th counter gets timings of the i-th node of GetNodes()
+    void Infer(int batch = -1, PerfCount *nodesCounters = nullptr);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
@@ -75,7 +90,33 @@ public:
         return eng;
     }
 
-    void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap,
+                     const PerfCount *nodesCounters = nullptr) const;
+
+    // Stages of CreateGraph, their wall times are kept to see startup regressions
+    enum LoadStage {
+        LoadParse = 0,
+        LoadOptimize,
+        LoadSelectDescriptors,
+        LoadAllocate,
+        LoadCreatePrimitives,
+        LoadStagesNum
+    };
+
+    /**
+     * Adds the memory of this graph copy to info. Prepared weights found in countedWeights are shared
+     * with a copy which was already added, so they are not counted again.
+     */
+    void GetMemoryInfo(InferenceEngine::MemoryInfo &info, std::unordered_set<const MKLDNNMemory *> &countedWeights) const;
+
+    // Wall time of the stage of the last CreateGraph call in microseconds
+    uint64_t GetLoadTime(LoadStage stage) const {
+        return loadTimes[stage];
+    }
+
+    const std::shared_ptr<InferenceEngine::IAllocator>& getBlobAllocator() const {
+        return blobAllocator;
+    }
 
 protected:
     MKLDNNNodePtr FindNodeWithName(const std::string& name) const;
@@ -91,11 +132,30 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        sharedMemories.clear();
+        sharedBase = nullptr;
+        for (auto &time : loadTimes) time = 0;
     }
     Status status;
     Config config;
 
     MKLDNNMemoryPtr memWorkspace;
+    // Sizes in bytes found by AllocateWithReuse
+    size_t activationsNoReuse = 0;
+    size_t workspaceLowerBound = 0;
+    size_t constantsSize = 0;
+    uint64_t loadTimes[LoadStagesNum] = {};
+    // Allocates input and output blobs of infer requests according to the memory policy
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
+    // Prepared weights shared with other copies of the graph, nullptr if the graph owns its weights
+    MKLDNNWeightsCache::Ptr weightsCache;
+    // Activation memory shared with other graphs executed by the same stream, nullptr if the graph owns it
+    MKLDNNWorkspaceGroup::Ptr workspaceGroup;
+    size_t sharedWorkspaceSize = 0;
+    // Generation and address of the group memory the shared edges point to and their offsets in it
+    uint64_t sharedGeneration = 0;
+    uint8_t *sharedBase = nullptr;
+    std::vector<std::pair<MKLDNNMemoryPtr, size_t>> sharedMemories;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -106,10 +166,18 @@ protected:
 
     mkldnn::engine eng;
 
+    // Applies threads number and affinity of the config to the thread team of the calling thread
+    void BindThreads();
+
     void InitNodes();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    // Groups the edges which are views on one memory, i.e. the not allocated edges with the edges they share
+    // memory with. Virtual to compare the grouping with a reference one in tests.
+    virtual std::vector<std::vector<MKLDNNEdgePtr>> ClusterEdges();
+    // Points the shared edges to the current memory of the workspace group
+    void BindSharedWorkspace();
     void CreatePrimitives();
 
     friend class MKLDNNInferRequest;
@@ -141,9 +209,21 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void GetMemoryInfo(InferenceEngine::MemoryInfo &info) override;
+
 protected:
-    MKLDNNGraph::Ptr graph;
+    // Execution stream: a copy of the graph which is executed by its own thread team
+    struct Stream {
+        MKLDNNGraph::Ptr graph;
+        InferenceEngine::ITaskExecutor::Ptr executor;
+        InferenceEngine::TaskSynchronizer::Ptr synchronizer;
+    };
+
+    std::vector<Stream> streams;
+    std::atomic<size_t> nextStream;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // Time Wait spins before it blocks, 0 if the network isn't tuned for latency
+    int64_t spinWaitMicros;
 
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
 };
@@ -8,6 +8,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <memory>
+#include <utility>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -17,7 +19,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1) {}
 
 
-template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
+template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob,
+                                                                       CopyStatistics *copies) {
     InferenceEngine::TBlob<T> *in_f = dynamic_cast<InferenceEngine::TBlob<T> *>(inputBlob.get());
 
     if (in_f == nullptr) {
@@ -28,7 +31,23 @@ template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
 
-    graph->PushInputData(inputName, inputBlob);
+    size_t copied = graph->PushInputData(inputName, inputBlob);
+    if (copies)
+        copies->add(copied);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::CopyStatistics::add(size_t copied) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    if (copied == 0)
+        return;
+    copies.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(copied, std::memory_order_relaxed);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::CopyStatistics::reset() {
+    count.store(0, std::memory_order_relaxed);
+    copies.store(0, std::memory_order_relaxed);
+    bytes.store(0, std::memory_order_relaxed);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
@@ -37,89 +56,175 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
 
+    bool measure = graph->config.collectPerfCounters;
+
     // execute input pre-processing.
     execDataPreprocessing();
 
-    changeDefaultPtr();
     // need to retain converted blobs until infer finish
     std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-    for (auto input : _inputs) {
-        if (!_networkInputs[input.first]) {
-            THROW_IE_EXCEPTION <<
-                               "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                               << input.first;
-        }
-        /*if (_networkInputs[input.first]->getInputPrecision() != input.second->precision()) {
-            THROW_IE_EXCEPTION << "Different input precision for input " << input.first
-                               << " registered in IInferencePlugin::LoadNetwork network and IInferencePlugin::Infer. "
-                               << _networkInputs[input.first]->getInputPrecision() << " vs "
-                               << input.second->precision();
-        }*/
+    {
+        PerfHelper inputsPerf(inputsCounter, nullptr, true, measure);
+        changeDefaultPtr();
+        size_t inputIdx = 0;
+        for (auto input : _inputs) {
+            if (!_networkInputs[input.first]) {
+                THROW_IE_EXCEPTION <<
+                                   "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                                   << input.first;
+            }
+            /*if (_networkInputs[input.first]->getInputPrecision() != input.second->precision()) {
+                THROW_IE_EXCEPTION << "Different input precision for input " << input.first
+                                   << " registered in IInferencePlugin::LoadNetwork network and IInferencePlugin::Infer. "
+                                   << _networkInputs[input.first]->getInputPrecision() << " vs "
+                                   << input.second->precision();
+            }*/
 
 
 
-        InferenceEngine::Blob::Ptr iconv;
-        InferenceEngine::TBlob<float> *in_f = nullptr;
-        switch (input.second->precision()) {
-            case InferenceEngine::Precision::FP32:
-                pushInput<float>(input.first, input.second);
-                break;
-            case InferenceEngine::Precision::U16:
-                // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                        InferenceEngine::Precision::FP32,
-                        input.second->getTensorDesc().getLayout(), input.second->dims());
-                convertedInputs.push_back(iconv);
-                iconv->allocate();
-                in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                pushInput<float>(input.first, iconv);
-                break;
-            case InferenceEngine::Precision::I16:
-                if (graph->hasMeanImageFor(input.first)) {
-                    // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
-                } else {
-                    // Instead we can send I16 directly
-                    pushInput<int16_t>(input.first, input.second);
-                }
-                break;
-            case InferenceEngine::Precision::U8:
-                if (graph->hasMeanImageFor(input.first)) {
-                    // If a mean image exists, we convert the blob and send FP32
+            CopyStatistics *copies = measure ? &inputCopies[inputIdx] : nullptr;
+            inputIdx++;
+
+            InferenceEngine::Blob::Ptr iconv;
+            InferenceEngine::TBlob<float> *in_f = nullptr;
+            switch (input.second->precision()) {
+                case InferenceEngine::Precision::FP32:
+                    pushInput<float>(input.first, input.second, copies);
+                    break;
+                case InferenceEngine::Precision::U16:
+                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
                     iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
                             InferenceEngine::Precision::FP32,
                             input.second->getTensorDesc().getLayout(), input.second->dims());
                     convertedInputs.push_back(iconv);
                     iconv->allocate();
                     in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
-                } else {
-                    // Instead we can send I8 directly
-                    pushInput<uint8_t>(input.first, input.second);
-                }
-                break;
-            default:
-                THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
+                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
+                    pushInput<float>(input.first, iconv, copies);
+                    break;
+                case InferenceEngine::Precision::I16:
+                    if (graph->hasMeanImageFor(input.first)) {
+                        // If a mean image exists, we convert the blob and send FP32
+                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+                                InferenceEngine::Precision::FP32,
+                                input.second->getTensorDesc().getLayout(), input.second->dims());
+                        convertedInputs.push_back(iconv);
+                        iconv->allocate();
+                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
+                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
+                        pushInput<float>(input.first, iconv, copies);
+                    } else {
+                        // Instead we can send I16 directly
+                        pushInput<int16_t>(input.first, input.second, copies);
+                    }
+                    break;
+                case InferenceEngine::Precision::U8:
+                    if (graph->hasMeanImageFor(input.first)) {
+                        // If a mean image exists, we convert the blob and send FP32
+                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+                                InferenceEngine::Precision::FP32,
+                                input.second->getTensorDesc().getLayout(), input.second->dims());
+                        convertedInputs.push_back(iconv);
+                        iconv->allocate();
+                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
+                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
+                        pushInput<float>(input.first, iconv, copies);
+                    } else {
+                        // Instead we can send I8 directly
+                        pushInput<uint8_t>(input.first, input.second, copies);
+                    }
+                    break;
+                default:
+                    THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
+            }
         }
     }
-    graph->Infer(m_curBatch);
-    graph->PullOutputData(_outputs);
+
+    graph->Infer(m_curBatch, nodesCounters.data());
+
+    PerfHelper outputsPerf(outputsCounter, nullptr, true, measure);
+    graph->PullOutputData(_outputs, measure ? outputsCopied.data() : nullptr);
+    for (size_t i = 0; measure && i < outputCopies.size(); i++)
+        outputCopies[i].add(outputsCopied[i]);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
-    graph->GetPerfData(perfMap);
+    graph->GetPerfData(perfMap, nodesCounters.data());
+
+    auto addStage = [&](const std::string &name, const char *type, const PerfCount &counter) {
+        // Stages which never ran, e.g. pre-processing of a network without resize, are not reported
+        if (counter.statistics().count == 0)
+            return;
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[name];
+        counter.fill(pc);
+        std::string execType = "unknown";
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string(type).copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    };
+    addStage("<preprocessing>", "Preprocessing", preprocessCounter);
+    addStage("<inputs copy>", "Copy", inputsCounter);
+    addStage("<outputs copy>", "Copy", outputsCounter);
+
+    // Whether the blobs were copied or used as the graph memory, e.g. the hetero plugin checks them to tell
+    // whether an intermediate blob is really shared by subgraphs. A blob which was never copied is OPTIMIZED_OUT,
+    // the execution type of a copied one is "memcpy: <bytes copied over all the inferences> bytes".
+    // The copies are counted only with the performance counters enabled, so they aren't reported otherwise.
+    auto addCopies = [&](const CopyStatistics &copied) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["<copy: " + copied.name + ">"];
+        pc = InferenceEngine::InferenceEngineProfileInfo();
+        pc.status = copied.copies.load(std::memory_order_relaxed) ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                                                  : InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT;
+        pc.realTime_uSec = pc.cpu_uSec = 0;
+        pc.execution_index = 0;
+        pc.count = copied.count.load(std::memory_order_relaxed);
+        std::string execType = "memcpy: " + std::to_string(copied.bytes.load(std::memory_order_relaxed)) + " bytes";
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("Copy").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    };
+    if (graph->config.collectPerfCounters) {
+        for (auto &copied : inputCopies)
+            addCopies(copied);
+        for (auto &copied : outputCopies)
+            addCopies(copied);
+    }
+
+    // One-time LoadNetwork stages of the graph. They are NOT_RUN as they are not a part of inference,
+    // and are reported with the other counters only, so sums over the default counters stay inference time.
+    if (!graph->config.collectPerfCounters)
+        return;
+    const std::pair<MKLDNNGraph::LoadStage, const char *> loadStages[] = {
+            {MKLDNNGraph::LoadParse, "<load: parse>"},
+            {MKLDNNGraph::LoadOptimize, "<load: optimize>"},
+            {MKLDNNGraph::LoadSelectDescriptors, "<load: select descriptors>"},
+            {MKLDNNGraph::LoadAllocate, "<load: allocate>"},
+            {MKLDNNGraph::LoadCreatePrimitives, "<load: create primitives>"}};
+    for (const auto &stage : loadStages) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[stage.second];
+        pc = InferenceEngine::InferenceEngineProfileInfo();
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        // Only the wall time of a stage is measured
+        pc.realTime_uSec = pc.min_uSec = pc.max_uSec = pc.p50_uSec = pc.p90_uSec = pc.p99_uSec =
+                static_cast<long long>(graph->GetLoadTime(stage.first));
+        pc.cpu_uSec = 0;
+        pc.count = 1;
+        std::string("load").copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("LoadNetwork").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ResetPerformanceCounts() {
+    for (auto &counter : nodesCounters)
+        counter.reset();
+    preprocessCounter.reset();
+    inputsCounter.reset();
+    outputsCounter.reset();
+    for (auto &copied : inputCopies)
+        copied.reset();
+    for (auto &copied : outputCopies)
+        copied.reset();
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -150,7 +255,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc.setPrecision(_networkInputs[name]->getInputPrecision());
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = make_blob_with_precision(desc, graph->getBlobAllocator());
         _inputs[name]->allocate();
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
@@ -170,7 +275,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
+        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc(), graph->getBlobAllocator());
         _outputs[name]->allocate();
         if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
                 !graph->getProperty().batchLimit) {
@@ -266,7 +371,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             bool canBeInPlace = true;
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
+                // constant children of an input may only read its dimensions, the data is not needed for them
+                if (child->isConstant() && !child->isShapeOnly())
                     canBeInPlace = false;
                 auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
                 if (canBeInPlace && concat && concat->isOptimized())
@@ -329,6 +435,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
+    nodesCounters = std::vector<PerfCount>(graph->GetNodes().size());
 
     InferenceEngine::BlobMap blobs;
     this->graph->getInputBlobs(blobs);
@@ -342,6 +449,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph:
         InferenceEngine::Blob::Ptr blob;
         GetBlob(it.first.c_str(), blob);
     }
+
+    // _inputs has a blob for every input now and SetBlob only replaces them, so its order doesn't change
+    inputCopies = std::vector<CopyStatistics>(_inputs.size());
+    size_t i = 0;
+    for (const auto& input : _inputs)
+        inputCopies[i++].name = input.first;
+    auto& outputNodes = graph->GetOutputNodes();
+    outputCopies = std::vector<CopyStatistics>(outputNodes.size());
+    outputsCopied.assign(outputNodes.size(), 0);
+    for (i = 0; i < outputNodes.size(); i++)
+        outputCopies[i].name = outputNodes[i]->getName().substr(4);  // remove out_ from node name
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
@@ -6,9 +6,11 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <mkldnn_preprocess_data.hpp>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
@@ -24,6 +26,8 @@ public:
 
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
+    void ResetPerformanceCounts() override;
+
     /**
      * @brief Given optional implementation of setting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
@@ -43,6 +47,7 @@ public:
     void SetBatch(int batch = -1) override;
 
     void execDataPreprocessing() {
+        PerfHelper perf(preprocessCounter, nullptr, true, graph->config.collectPerfCounters && !_preProcData.empty());
         for (auto &input : _inputs) {
             // If there is a pre-process entry for an input then it must be pre-processed
             // using preconfigured resize algorithm.
@@ -55,7 +60,21 @@ public:
     }
 
 private:
-    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    // Copies between a blob of this request and the graph memory. There are none for the blobs
+    // the graph edges were pointed to.
+    struct CopyStatistics {
+        std::string name;
+        // Inferences the blob was passed to or from the graph
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> copies{0};
+        std::atomic<uint64_t> bytes{0};
+
+        void add(size_t copied);
+        void reset();
+    };
+
+    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob,
+                                         CopyStatistics *copies);
 
     void changeDefaultPtr();
     MKLDNNGraph::Ptr graph;
@@ -65,5 +84,18 @@ private:
     std::map<std::string, MKLDNNPreProcessData> _preProcData;  // pre-process data per input
 
     int m_curBatch;
+
+    // Timings of this request only, the counters of the graph nodes are shared by all requests of the graph
+    std::vector<PerfCount> nodesCounters;
+    PerfCount preprocessCounter;
+    PerfCount inputsCounter;
+    PerfCount outputsCounter;
+
+    // Created by SetGraph for every input in the order of _inputs and every output in the order of the graph
+    // output nodes. They are only updated afterwards, so they may be read and reset while an inference runs.
+    std::vector<CopyStatistics> inputCopies;
+    std::vector<CopyStatistics> outputCopies;
+    // Bytes copied to the outputs by the running inference
+    std::vector<size_t> outputsCopied;
 };
 }  // namespace MKLDNNPlugin
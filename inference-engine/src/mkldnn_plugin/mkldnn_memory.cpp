@@ -19,7 +19,24 @@ using namespace mkldnn;
 
 namespace MKLDNNPlugin {
 
-MKLDNNMemory::MKLDNNMemory(const engine& eng) : eng(eng) {}
+MKLDNNMemory::MKLDNNMemory(const engine& eng, const MemoryPolicy& policy) : eng(eng), policy(policy) {}
+
+memory* MKLDNNMemory::allocate(const memory::primitive_desc& pdesc) {
+    // mkldnn allocates page aligned memory by itself which is enough unless placement is requested
+    size_t size = pdesc.get_size();
+    if (policy.isDefault()) {
+        block.reset();
+        allocatedSize = reservedSize = size;
+        return new memory(pdesc);
+    }
+
+    block.reset(alignedAlloc(size, policy), alignedFree);
+    if (!block)
+        THROW_IE_EXCEPTION << "Cannot allocate " << size << " bytes of memory.";
+    allocatedSize = size;
+    reservedSize = alignedReservedSize(block.get());
+    return new memory(pdesc, block.get());
+}
 
 size_t MKLDNNMemory::GetSize() const {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(GetDataType()));
@@ -54,7 +71,7 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(desc.data.data_type));
 
     if (data == nullptr) {
-        prim.reset(new memory(primitive_desc));
+        prim.reset(allocate(primitive_desc));
 
         size_t real_size = 0;
         if (prim->get_primitive_desc().desc().data.ndims > 0) {
@@ -70,6 +87,8 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data) {
     } else {
         // MKLDNN accepts not a const data, probably need to remove some level of consteness in a call stack
         prim.reset(new memory(primitive_desc, const_cast<void*>(data)));
+        block.reset();
+        allocatedSize = reservedSize = 0;
     }
 }
 
@@ -84,9 +103,11 @@ void MKLDNNMemory::CreateFrom(memory::dims dims, const MKLDNNMemory& src) {
 
 void MKLDNNMemory::CreateFrom(memory::primitive_desc &pdesc, const void* data) {
     if (data == nullptr) {
-        prim = std::shared_ptr<memory>(new memory(pdesc));
+        prim = std::shared_ptr<memory>(allocate(pdesc));
     } else {
         prim = std::shared_ptr<memory>(new memory(pdesc, const_cast<void*>(data)));
+        block.reset();
+        allocatedSize = reservedSize = 0;
     }
 }
 
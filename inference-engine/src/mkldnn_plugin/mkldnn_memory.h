@@ -14,6 +14,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <functional>
+#include <ie_memory_policy.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -69,7 +70,8 @@ using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
 
 class MKLDNNMemory {
 public:
-    explicit MKLDNNMemory(const mkldnn::engine& eng);
+    explicit MKLDNNMemory(const mkldnn::engine& eng,
+                          const InferenceEngine::MemoryPolicy& policy = InferenceEngine::MemoryPolicy());
 
     const mkldnn::memory& GetPrimitive() const {
         return *prim;
@@ -97,6 +99,16 @@ public:
 
     size_t GetSize() const;
 
+    // Bytes allocated for the data owned by this memory, 0 if it is a view on external data
+    size_t GetAllocatedSize() const {
+        return allocatedSize;
+    }
+
+    // Bytes taken from the system for the owned data, including alignment and page rounding
+    size_t GetReservedSize() const {
+        return reservedSize;
+    }
+
     mkldnn::memory::format GetFormat() const {
         return static_cast<mkldnn::memory::format>(prim->get_primitive_desc().desc().data.format);
     }
@@ -131,8 +143,15 @@ public:
     static void CreateBlockingDesc(mkldnn::memory::desc& desc);
 
 private:
+    mkldnn::memory* allocate(const mkldnn::memory::primitive_desc& pdesc);
+
     std::shared_ptr<mkldnn::memory> prim;
+    // Owns the data of memory created without an external pointer
+    std::shared_ptr<void> block;
     mkldnn::engine eng;
+    InferenceEngine::MemoryPolicy policy;
+    size_t allocatedSize = 0;
+    size_t reservedSize = 0;
 };
 
 
@@ -517,76 +517,90 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
-        auto& internalBlob = internalBlobs[i];
-        internalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(engine)));
-        MKLDNNDims blobDims = MKLDNNDims(internalBlob->getTensorDesc().getDims());
-        memory::format format = memory::oihw;
-
-        if (blobDims.ndims() == 1) {
-            format = memory::x;
-        } else if (blobDims.ndims() == 2) {
-            format = memory::oi;
-        } else if (blobDims.ndims() == 5) {
-            format = memory::goihw;
-        }
-        auto inDataType = MKLDNNMemoryDesc(getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc).getDataType();
-
-        MKLDNNDims real_dims = intDescs[i].getDims();
-        if (blobDims == real_dims) {  // No auto blocking
-            // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
-            internalBlobMemory[i]->Create(blobDims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, internalBlob->buffer(),
-                                           blobDims.size() * MKLDNNExtensionUtils::sizeOfDataType(inDataType));
-        } else {  // Auto blocking, logic and real dims are different
-            if (blobDims.ndims() != real_dims.ndims() || blobDims.ndims() > 5)
-                THROW_IE_EXCEPTION << getName() << " Error: CPU plugin supports auto blocking only "
-                                   << "for blobs with a number of dimensions less than 6!";
-            InferenceEngine::Blob::Ptr tmp_wght =
-                    InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, real_dims.ToSizeVector());
-
-            tmp_wght->allocate();
-
-            int with_group = 0;
-            if (blobDims.ndims() == 5)
-                with_group = 1;
-
-            // Logic dims
-            int L_G = blobDims.ndims() > 0 && with_group ? blobDims[0] : 1;
-            int L_N = blobDims.ndims() > 0 ? blobDims[0 + with_group] : 1;
-            int L_C = blobDims.ndims() > 1 ? blobDims[1 + with_group] : 1;
-            int L_H = blobDims.ndims() > 2 ? blobDims[2 + with_group] : 1;
-            int L_W = blobDims.ndims() > 3 ? blobDims[3 + with_group] : 1;
-
-            // Ref
-            int R_G = real_dims.ndims() > 0 && with_group ? real_dims[0] : 1;
-            int R_N = real_dims.ndims() > 0 ? real_dims[0 + with_group] : 1;
-            int R_C = real_dims.ndims() > 1 ? real_dims[1 + with_group] : 1;
-            int R_H = real_dims.ndims() > 2 ? real_dims[2 + with_group] : 1;
-            int R_W = real_dims.ndims() > 3 ? real_dims[3 + with_group] : 1;
-
-            if (L_H != R_H || L_W != R_W)
-                THROW_IE_EXCEPTION << "Unsuported mode of auto blocking tensors";
-
-            auto * tmp_data = tmp_wght->buffer().as<float*>();
-            auto * in_data = internalBlob->buffer().as<float*>();
-            memset(tmp_data, 0,  real_dims.size()* sizeof(float));
-
-            for (int g = 0; g < L_G; g++)
-            for (int n = 0; n < L_N; n++)
-            for (int c = 0; c < L_C; c++)
-            for (int h = 0; h < L_H; h++)
-            for (int w = 0; w < L_W; w++) {
-                int l_indx = g * L_N * L_C * L_H * L_W +
-                        n * L_C * L_H * L_W +
-                        c * L_H * L_W + h * L_W + w;
-                int r_indx = g * R_N * R_C * R_H * R_W +
-                        n * R_C * R_H * R_W +
-                        c * R_H * R_W + h * R_W + w;
-
-                tmp_data[r_indx] = in_data[l_indx];
+        auto create = [&] () -> MKLDNNMemoryPtr {
+            auto& internalBlob = internalBlobs[i];
+            MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine, memoryPolicy));
+            MKLDNNDims blobDims = MKLDNNDims(internalBlob->getTensorDesc().getDims());
+            memory::format format = memory::oihw;
+
+            if (blobDims.ndims() == 1) {
+                format = memory::x;
+            } else if (blobDims.ndims() == 2) {
+                format = memory::oi;
+            } else if (blobDims.ndims() == 5) {
+                format = memory::goihw;
+            }
+            auto inDataType = MKLDNNMemoryDesc(getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc).getDataType();
+
+            MKLDNNDims real_dims = intDescs[i].getDims();
+            if (blobDims == real_dims) {  // No auto blocking
+                // TODO: Cannot create memory from intDescs[i] because ScaleShift changes dims
+                _ptr->Create(blobDims, inDataType, intDescs[i].getFormat());
+                _ptr->SetData(inDataType, format, internalBlob->buffer(),
+                              blobDims.size() * MKLDNNExtensionUtils::sizeOfDataType(inDataType));
+            } else {  // Auto blocking, logic and real dims are different
+                if (blobDims.ndims() != real_dims.ndims() || blobDims.ndims() > 5)
+                    THROW_IE_EXCEPTION << getName() << " Error: CPU plugin supports auto blocking only "
+                                       << "for blobs with a number of dimensions less than 6!";
+                InferenceEngine::Blob::Ptr tmp_wght =
+                        InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, real_dims.ToSizeVector());
+
+                tmp_wght->allocate();
+
+                int with_group = 0;
+                if (blobDims.ndims() == 5)
+                    with_group = 1;
+
+                // Logic dims
+                int L_G = blobDims.ndims() > 0 && with_group ? blobDims[0] : 1;
+                int L_N = blobDims.ndims() > 0 ? blobDims[0 + with_group] : 1;
+                int L_C = blobDims.ndims() > 1 ? blobDims[1 + with_group] : 1;
+                int L_H = blobDims.ndims() > 2 ? blobDims[2 + with_group] : 1;
+                int L_W = blobDims.ndims() > 3 ? blobDims[3 + with_group] : 1;
+
+                // Ref
+                int R_G = real_dims.ndims() > 0 && with_group ? real_dims[0] : 1;
+                int R_N = real_dims.ndims() > 0 ? real_dims[0 + with_group] : 1;
+                int R_C = real_dims.ndims() > 1 ? real_dims[1 + with_group] : 1;
+                int R_H = real_dims.ndims() > 2 ? real_dims[2 + with_group] : 1;
+                int R_W = real_dims.ndims() > 3 ? real_dims[3 + with_group] : 1;
+
+                if (L_H != R_H || L_W != R_W)
+                    THROW_IE_EXCEPTION << "Unsuported mode of auto blocking tensors";
+
+                auto * tmp_data = tmp_wght->buffer().as<float*>();
+                auto * in_data = internalBlob->buffer().as<float*>();
+                memset(tmp_data, 0,  real_dims.size()* sizeof(float));
+
+                for (int g = 0; g < L_G; g++)
+                for (int n = 0; n < L_N; n++)
+                for (int c = 0; c < L_C; c++)
+                for (int h = 0; h < L_H; h++)
+                for (int w = 0; w < L_W; w++) {
+                    int l_indx = g * L_N * L_C * L_H * L_W +
+                            n * L_C * L_H * L_W +
+                            c * L_H * L_W + h * L_W + w;
+                    int r_indx = g * R_N * R_C * R_H * R_W +
+                            n * R_C * R_H * R_W +
+                            c * R_H * R_W + h * R_W + w;
+
+                    tmp_data[r_indx] = in_data[l_indx];
+                }
+                _ptr->Create(real_dims, inDataType, intDescs[i].getFormat());
+                _ptr->SetData(inDataType, format, tmp_wght->buffer(), tmp_wght->byteSize());
             }
-            internalBlobMemory[i]->Create(real_dims, inDataType, intDescs[i].getFormat());
-            internalBlobMemory[i]->SetData(inDataType, format, tmp_wght->buffer(), tmp_wght->byteSize());
+            return _ptr;
+        };
+
+        if (weightCache != nullptr) {
+            // All copies of the graph select the same descriptors, so the layer name, blob index
+            // and the prepared layout identify the same weights in every copy
+            std::string key = getName() + "_" + std::to_string(i) + "_" +
+                              std::to_string(intDescs[i].getFormat()) + "_" +
+                              std::to_string(intDescs[i].getDims().size());
+            internalBlobMemory.push_back(weightCache->findOrCreate(key, create));
+        } else {
+            internalBlobMemory.push_back(create());
         }
     }
 }
@@ -16,6 +16,7 @@
 #include <caseless.hpp>
 #include "mkldnn_dims.h"
 #include "mkldnn_memory.h"
+#include "mkldnn_weights_cache.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_descriptor.h"
 #include "mkldnn/iml_type_mapper.h"
@@ -177,6 +178,11 @@ public:
 
     bool isConstant();
 
+    // Outputs of the node are computed from the dimensions of its inputs, not from their data (e.g. PriorBox)
+    virtual bool isShapeOnly() const {
+        return false;
+    }
+
     bool isInplace() const;
 
     void fuseWith(const MKLDNNNodePtr &fuse) {
@@ -234,6 +240,19 @@ public:
 
     InferenceEngine::ProfilingTask &GetProfilingTask() { return profilingTask; }
 
+    void setMemoryPolicy(const InferenceEngine::MemoryPolicy& policy) {
+        memoryPolicy = policy;
+    }
+
+    void setWeightsCache(const MKLDNNWeightsCache::Ptr& cache) {
+        weightCache = cache;
+    }
+
+    // Prepared weights and biases, may be shared with the copies of the node in other graphs
+    const std::vector<MKLDNNMemoryPtr>& getInternalBlobMemory() const {
+        return internalBlobMemory;
+    }
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -341,6 +360,8 @@ protected:
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
+    InferenceEngine::MemoryPolicy memoryPolicy;
+    MKLDNNWeightsCache::Ptr weightCache;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
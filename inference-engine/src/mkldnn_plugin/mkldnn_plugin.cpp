@@ -6,6 +6,8 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <ie_util_internal.hpp>
+#include <graph_transformer.h>
 #include <memory>
 
 using namespace MKLDNNPlugin;
@@ -42,7 +44,20 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
         conf.batchLimit = network.getBatchSize();
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
+    // the network of the caller is not changed, constants are folded in a copy
+    InferenceEngine::details::CNNNetworkImplPtr folded;
+    if (conf.foldConstants) {
+        folded = cloneNet(network);
+        if (InferenceEngine::foldConstants(*folded) == 0)
+            folded = nullptr;
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(folded ? *folded : network, conf, extensionManager);
+    // The copy shares the blobs of the layers which were not folded with the network of the caller,
+    // so the IR buffer is freed only if both release them
+    if (folded && conf.releaseWeights)
+        releaseNetworkBlobs(network);
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
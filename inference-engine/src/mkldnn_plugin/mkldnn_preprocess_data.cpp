@@ -5,14 +5,7 @@
 
 #include <algorithm>
 #include <immintrin.h>
-#if defined(_OPENMP)
-#include <omp.h>
-#else
-inline int omp_get_max_threads() { return 1; }
-inline int omp_get_num_threads() { return 1; }
-inline int omp_get_thread_num() { return 0; }
-inline int omp_in_parallel() { return 0; }
-#endif
+#include "ie_parallel.hpp"
 
 #include "mkldnn_preprocess_data.hpp"
 #include "blob_transform.hpp"
@@ -116,9 +109,9 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     auto *beta = reinterpret_cast<int16_t *>(yofs + dheight);
     auto *tptr = reinterpret_cast<uint8_t *>(beta + dheight);
 
-    int id_count = IS_PARALLEL_EXEC ? omp_get_max_threads() : 1;
+    int id_count = IS_PARALLEL_EXEC ? parallel_get_max_threads() : 1;
     for (int id = 0; id < id_count; id++) {
-        auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+        auto tptr_ = tptr + parallel_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
 
         tptr_[0] = (uint8_t) border.value;
         tptr_[1] = (uint8_t) border.value;
@@ -184,7 +177,7 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         auto full_pass = [&](int c, int y) {
             auto sptr_ = sptr + c * origSrcW * origSrcH;
             auto dptr_ = dptr + c * origDstW * origDstH;
-            auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+            auto tptr_ = tptr + parallel_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
 
             for (int x = 0; x < swidth; x++) {
                 int val0 = (yofs[y] < 0) ? border.value : sptr_[yofs[y] + x + 0];
@@ -205,12 +198,9 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
         };
 
         if (IS_PARALLEL_EXEC) {
-            #pragma omp parallel for schedule(static) collapse(2)
-            for (int c = 0; c < channels; c++) {
-                for (int y = 0; y < dheight; y++) {
-                    full_pass(c, y);
-                }
-            }
+            parallel_for2d(channels, dheight, [&](int c, int y) {
+                full_pass(c, y);
+            });
         } else {
             for (int c = 0; c < channels; c++) {
                 for (int y = 0; y < dheight; y++) {
@@ -382,25 +372,24 @@ void resize_bilinear_u8(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buff
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y <= dheight - rows_block_size; y += rows_block_size) {
-                auto sptr_ = sptr + c * origSrcW * origSrcH;
-                auto dptr_ = dptr + c * origDstW * origDstH;
-                auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+        const int rows_blocks = dheight >= rows_block_size ? (dheight - rows_block_size) / rows_block_size + 1 : 0;
+        parallel_for2d(channels, rows_blocks, [&](int c, int yb) {
+            int y = yb * rows_block_size;
+            auto sptr_ = sptr + c * origSrcW * origSrcH;
+            auto dptr_ = dptr + c * origDstW * origDstH;
+            auto tptr_ = tptr + parallel_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
 
-                full_pass_vec(sptr_, dptr_, tptr_, y);
+            full_pass_vec(sptr_, dptr_, tptr_, y);
 
-                if (y + rows_block_size > dheight - rows_block_size)
-                    full_pass_vec(sptr_, dptr_, tptr_, dheight - rows_block_size);
-            }
-        }
+            if (y + rows_block_size > dheight - rows_block_size)
+                full_pass_vec(sptr_, dptr_, tptr_, dheight - rows_block_size);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y <= dheight - rows_block_size; y += rows_block_size) {
                 auto sptr_ = sptr + c * origSrcW * origSrcH;
                 auto dptr_ = dptr + c * origDstW * origDstH;
-                auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
+                auto tptr_ = tptr + parallel_get_thread_num() * (((swidth + 7) / 8) * 8 * 8);
 
                 full_pass_vec(sptr_, dptr_, tptr_, y);
 
@@ -495,7 +484,7 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
     auto full_pass = [&](int c, int y) {
         auto sptr_ = sptr + c * origSrcW * origSrcH;
         auto dptr_ = dptr + c * origDstW * origDstH;
-        auto tptr_ = tptr + omp_get_thread_num() * (((swidth + 1) / 2) * 2 * 2);
+        auto tptr_ = tptr + parallel_get_thread_num() * (((swidth + 1) / 2) * 2 * 2);
 
         for (int x = 0; x < swidth; x++) {
             bool use_constant0 = yofs[y] + 0 < 0 || yofs[y] + 0 >= src_full_height;
@@ -519,12 +508,9 @@ void resize_bilinear_fp32(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* bu
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y < dheight; y++) {
-                full_pass(c, y);
-            }
-        }
+        parallel_for2d(channels, dheight, [&](int c, int y) {
+            full_pass(c, y);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y < dheight; y++) {
@@ -686,7 +672,7 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
     computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
     computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
 
-    int vest_sum_size = IS_PARALLEL_EXEC ? 2*swidth*omp_get_max_threads() : 2*swidth;
+    int vest_sum_size = IS_PARALLEL_EXEC ? 2*swidth*parallel_get_max_threads() : 2*swidth;
     uint16_t* vert_sum = yalpha + dheight*y_max_count;
     uint16_t* alpha0 = vert_sum + vest_sum_size;
     uint16_t* alpha1 = alpha0 + dwidth;
@@ -703,7 +689,7 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
 
     auto full_pass = [&](int c, int y) {
         uint8_t* pdst_row = dptr + (y * dstep) + c * origDstW * origDstH;
-        uint16_t* vert_sum_ = vert_sum + 2*swidth*omp_get_thread_num();
+        uint16_t* vert_sum_ = vert_sum + 2*swidth*parallel_get_thread_num();
 
         int ysi_row = ysi[y];
 
@@ -963,12 +949,9 @@ void resize_area_u8_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int c = 0; c < channels; c++) {
-            for (int y = 0; y < dheight; y++) {
-                full_pass(c, y);
-            }
-        }
+        parallel_for2d(channels, dheight, [&](int c, int y) {
+            full_pass(c, y);
+        });
     } else {
         for (int c = 0; c < channels; c++) {
             for (int y = 0; y < dheight; y++) {
@@ -1051,7 +1034,7 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     float scale_x = static_cast<float>(src_full_width) / dst_full_width;
     float scale_y = static_cast<float>(src_full_height) / dst_full_height;
 
-    int vert_sum_size = IS_PARALLEL_EXEC ? omp_get_max_threads() * swidth : swidth;
+    int vert_sum_size = IS_PARALLEL_EXEC ? parallel_get_max_threads() * swidth : swidth;
     int tabofs_size = std::max(2*swidth, 2*dwidth);
     int xsi_size = std::max(2*swidth, 2*dwidth);
     int xdi_size = std::max(2*swidth, 2*dwidth);
@@ -1080,7 +1063,7 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     tabofs[dy_] = ytab_size;
 
     auto full_pass = [&](const float* sptr_, float* dptr_, int y) {
-        auto vert_sum_ = vert_sum + omp_get_thread_num() * swidth;
+        auto vert_sum_ = vert_sum + parallel_get_thread_num() * swidth;
 
         memset(vert_sum_, 0, swidth * sizeof(float));
 
@@ -1113,15 +1096,12 @@ void resize_area_fp32_downscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int ch = 0; ch < channels; ch++) {
-            for (int y = 0; y < dheight; y++) {
-                auto sptr_ = sptr + ch * origSrcH * origSrcW;
-                auto dptr_ = dptr + ch * origDstH * origDstW;
+        parallel_for2d(channels, dheight, [&](int ch, int y) {
+            auto sptr_ = sptr + ch * origSrcH * origSrcW;
+            auto dptr_ = dptr + ch * origDstH * origDstW;
 
-                full_pass(sptr_, dptr_, y);
-            }
-        }
+            full_pass(sptr_, dptr_, y);
+        });
     } else {
         for (int ch = 0; ch < channels; ch++) {
             for (int y = 0; y < dheight; y++) {
@@ -1282,7 +1262,7 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
         for (int k = 0; k < ksize; k++) {
             prev_sy[k] = -1;
             rows[k] = reinterpret_cast<float*>(buffer + (width + dheight)*(sizeof(int) + sizeof(float)*ksize))
-                      + k*bufstep + ksize*bufstep*omp_get_thread_num();
+                      + k*bufstep + ksize*bufstep*parallel_get_thread_num();
         }
 
         int sy0 = yofs[dy], k0 = ksize, k1 = 0;
@@ -1311,15 +1291,12 @@ static void resize_area_upscale(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8
     };
 
     if (IS_PARALLEL_EXEC) {
-        #pragma omp parallel for schedule(static) collapse(2)
-        for (int ch = 0; ch < channels; ch++) {
-            for (int dy = 0; dy < dheight; dy++) {
-                auto sptr_ = sptr + ch * origSrcH * origSrcW;
-                auto dptr_ = dptr + ch * origDstH * origDstW;
+        parallel_for2d(channels, dheight, [&](int ch, int dy) {
+            auto sptr_ = sptr + ch * origSrcH * origSrcW;
+            auto dptr_ = dptr + ch * origDstH * origDstW;
 
-                full_pass(sptr_, dptr_, dy);
-            }
-        }
+            full_pass(sptr_, dptr_, dy);
+        });
     } else {
         for (int ch = 0; ch < channels; ch++) {
             for (int dy = 0; dy < dheight; dy++) {
@@ -1348,7 +1325,7 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
     float scale_x = static_cast<float>(dstDims[3]) / srcDims[3];
     float scale_y = static_cast<float>(dstDims[2]) / srcDims[2];
 
-    int threads_count = is_parallel_exec ? omp_get_max_threads() : 1;
+    int threads_count = is_parallel_exec ? parallel_get_max_threads() : 1;
 
     size_t buffer_size;
     if ((scale_x >= 1 || scale_y >= 1) && algorithm == RESIZE_AREA) {
@@ -1526,39 +1503,32 @@ static void parallel_blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     int _W_dst_stride = C;
 
     if (src->layout() == NHWC && dst->layout() == NCHW) {
-#       pragma omp parallel for collapse(2)
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+        parallel_for2d(N, C, [&](int n, int c) {
+            data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
+            data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            for (int h = 0; h < H; h++) {
+                data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
+                for (int w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->layout() == NCHW && dst->layout() == NHWC) {
-#       pragma omp parallel for collapse(2)
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * H * W;
-                data_t *dst_ptr_l = dst_ptr + n * _N_dst_stride + c;
-                for (int hw = 0; hw < H*W; hw++) {
-                    *dst_ptr_l = *src_ptr_l;
-                    dst_ptr_l += _W_dst_stride;
-                    src_ptr_l++;
-                }
+        parallel_for2d(N, C, [&](int n, int c) {
+            data_t *src_ptr_l = src_ptr + n * N_src_stride + c * H * W;
+            data_t *dst_ptr_l = dst_ptr + n * _N_dst_stride + c;
+            for (int hw = 0; hw < H*W; hw++) {
+                *dst_ptr_l = *src_ptr_l;
+                dst_ptr_l += _W_dst_stride;
+                src_ptr_l++;
             }
-        }
+        });
     } else {
-#       pragma omp parallel for
-        for (int i = 0; i < N*C*H*W; i++) {
+        parallel_for(N*C*H*W, [&](int i) {
             dst_ptr[i] = src_ptr[i];
-        }
+        });
     }
 }
 
@@ -0,0 +1,26 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_weights_cache.h"
+
+#include <string>
+
+using namespace MKLDNNPlugin;
+
+MKLDNNMemoryPtr MKLDNNWeightsCache::findOrCreate(const std::string& key, const std::function<MKLDNNMemoryPtr()>& create) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+    if (found != sharedWeights.end())
+        return found->second;
+
+    MKLDNNMemoryPtr memory = create();
+    sharedWeights[key] = memory;
+    return memory;
+}
+
+size_t MKLDNNWeightsCache::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return sharedWeights.size();
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Keeps prepared (reordered) weights which can be shared between several copies of the same graph.
+ * Execution streams placed on one NUMA node share one cache, so weights are prepared once per node
+ * and read from the local memory by all streams of that node.
+ */
+class MKLDNNWeightsCache {
+public:
+    typedef std::shared_ptr<MKLDNNWeightsCache> Ptr;
+
+    /**
+     * @brief Returns memory registered for the key, calls create() and registers its result otherwise
+     * @note Can be called from several threads
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& key, const std::function<MKLDNNMemoryPtr()>& create);
+
+    size_t size() const;
+
+private:
+    mutable std::mutex guard;
+    std::unordered_map<std::string, MKLDNNMemoryPtr> sharedWeights;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,63 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_group.h"
+
+#include <map>
+#include <string>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNWorkspaceGroup::MKLDNNWorkspaceGroup(const MemoryPolicy& policy)
+        : eng(mkldnn::engine::kind::cpu, 0), policy(policy) {}
+
+MKLDNNWorkspaceGroup::Ptr MKLDNNWorkspaceGroup::get(const std::string& name, int stream, const MemoryPolicy& policy) {
+    static std::mutex registryGuard;
+    static std::map<std::pair<std::string, int>, std::weak_ptr<MKLDNNWorkspaceGroup>> registry;
+
+    std::lock_guard<std::mutex> lock(registryGuard);
+    auto& entry = registry[{name, stream}];
+    Ptr group = entry.lock();
+    if (!group) {
+        group = std::make_shared<MKLDNNWorkspaceGroup>(policy);
+        entry = group;
+    }
+    return group;
+}
+
+void MKLDNNWorkspaceGroup::reserve(size_t bytes) {
+    std::unique_lock<std::mutex> lock(guard);
+    if (bytes <= (memory ? memory->GetSize() : 0))
+        return;
+
+    // The memory can't be replaced under a graph which is executed now
+    released.wait(lock, [&] { return holder == nullptr; });
+
+    size_t floats = (bytes + sizeof(float) - 1) / sizeof(float);
+    MKLDNNMemoryPtr grown(new MKLDNNMemory(eng, policy));
+    grown->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, floats}, Layout::NC)));
+    memory = grown;
+    memoryGeneration++;
+}
+
+void MKLDNNWorkspaceGroup::acquire(const void* owner) {
+    std::lock_guard<std::mutex> lock(guard);
+    if (holder != nullptr)
+        THROW_IE_EXCEPTION << "Workspace group is used by another network at the same time. "
+                           << "Networks of a workspace group must be executed one by one";
+    holder = owner;
+}
+
+void MKLDNNWorkspaceGroup::release(const void* owner) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        if (holder != owner)
+            return;
+        holder = nullptr;
+    }
+    released.notify_all();
+}
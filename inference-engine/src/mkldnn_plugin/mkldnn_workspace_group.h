@@ -0,0 +1,93 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include "mkldnn_memory.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Activation memory shared by graphs which are never executed at the same time,
+ * e.g. models of a cascade executed one after another by the same stream.
+ * The memory is sized to the biggest requirement of the joined graphs. A graph holds the group
+ * while it is executed, so concurrent use of the group is detected and reported. A graph which joins
+ * while another one is executed waits for the end of the execution to grow the memory.
+ */
+class MKLDNNWorkspaceGroup {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspaceGroup> Ptr;
+
+    explicit MKLDNNWorkspaceGroup(const InferenceEngine::MemoryPolicy& policy = InferenceEngine::MemoryPolicy());
+
+    /**
+     * @brief Returns the group registered for the name and the stream index, creates it if there is no one.
+     * The group lives while it is used by at least one graph.
+     */
+    static Ptr get(const std::string& name, int stream, const InferenceEngine::MemoryPolicy& policy);
+
+    /**
+     * @brief Grows the memory to at least size bytes. Pointers to the previous memory become invalid,
+     * users detect it by a changed generation().
+     * @note Waits till the group is released if it is held by a graph
+     */
+    void reserve(size_t size);
+
+    /**
+     * @brief Marks the group as held by the owner
+     * @note Throws if the group is already held by another owner
+     */
+    void acquire(const void* owner);
+    void release(const void* owner);
+
+    void* data() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return memory ? memory->GetData() : nullptr;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return memory ? memory->GetSize() : 0;
+    }
+
+    // Changes each time the memory is reallocated
+    uint64_t generation() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return memoryGeneration;
+    }
+
+    /**
+     * @brief Holds the group for the lifetime of the object
+     */
+    class Holder {
+    public:
+        Holder(const Ptr& group, const void* owner): group(group), owner(owner) {
+            if (group) group->acquire(owner);
+        }
+        ~Holder() {
+            if (group) group->release(owner);
+        }
+
+    private:
+        Ptr group;
+        const void* owner;
+    };
+
+private:
+    mkldnn::engine eng;
+    InferenceEngine::MemoryPolicy policy;
+    MKLDNNMemoryPtr memory;
+    uint64_t memoryGeneration = 0;
+
+    mutable std::mutex guard;
+    std::condition_variable released;
+    const void* holder = nullptr;
+};
+
+}  // namespace MKLDNNPlugin
@@ -252,14 +252,14 @@ void MKLDNNConvolutionNode::createPrimitive() {
         if (convolutionNode) {
             auto* convLayer = reinterpret_cast<ConvolutionLayer*>(convolutionNode->getCnnLayer().get());
 
-            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine(), memoryPolicy)));
             MKLDNNDims dwWeightsDims({dw_conv_oc, 1, 1, dw_conv_kh, dw_conv_kw});
             DWConvInternalBlobMemory[0]->Create(dwWeightsDims, memory::data_type::f32, memory::format::Goihw8g);
 
             DWConvInternalBlobMemory[0]->SetData(memory::data_type::f32, memory::goihw, convLayer->_weights->buffer(),
                                dwWeightsDims.size() * MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
 
-            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            DWConvInternalBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine(), memoryPolicy)));
             MKLDNNDims dwBiasesDims({dw_conv_oc});
             DWConvInternalBlobMemory[1]->Create(dwBiasesDims, memory::data_type::f32, memory::format::x);
             DWConvInternalBlobMemory[1]->SetData(memory::data_type::f32, memory::x, convLayer->_biases->buffer(),
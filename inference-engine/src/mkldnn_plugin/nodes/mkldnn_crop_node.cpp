@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -150,24 +151,22 @@ void MKLDNNCropNode::execute(mkldnn::stream strm) {
     float *dst_data = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int n = 0; n < ON; ++n) {
-        for (int c = 0; c < OC; c += m_block_size) {
-            for (int h = 0; h < OH; ++h) {
-                int dst_ind =
-                        n*OC*OH*OW + c*OH*OW +
-                        h*OW*m_block_size;
-
-                int src_ind =
-                        (n+OFFSET_N)*IC*IH*IW +
-                        (c+OFFSET_C)*IH*IW +
-                        (h+OFFSET_H)*IW*m_block_size +
-                        OFFSET_W*m_block_size;
-
-                memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
-            }
+    parallel_for2d(ON, div_up(OC, m_block_size), [&](int n, int cb) {
+        int c = cb * m_block_size;
+        for (int h = 0; h < OH; ++h) {
+            int dst_ind =
+                    n*OC*OH*OW + c*OH*OW +
+                    h*OW*m_block_size;
+
+            int src_ind =
+                    (n+OFFSET_N)*IC*IH*IW +
+                    (c+OFFSET_C)*IH*IW +
+                    (h+OFFSET_H)*IW*m_block_size +
+                    OFFSET_W*m_block_size;
+
+            memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
         }
-    }
+    });
 }
 
 bool MKLDNNCropNode::created() const {
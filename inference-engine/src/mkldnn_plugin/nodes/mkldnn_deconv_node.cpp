@@ -11,6 +11,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -129,19 +130,17 @@ void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
         const int blksize = fmt == memory::nChw16c ? 16 :
                             fmt == memory::nChw8c ? 8 : 1;
 
-#   pragma omp parallel for collapse(4) schedule(static)
-        for (int n = 0; n < N; ++n)
-        for (int c = 0; c < C / blksize; ++c)
-        for (int h = 0; h < H; ++h)
-        for (int w = 0; w < W; ++w) {
-            const int off =
-                    n * C * H * W + c * H * W * blksize +
-                    h * W * blksize + w * blksize;
-            auto o = &output[off];
-            for (int bc = 0; bc < blksize; ++bc) {
-                o[bc] += bias[c*blksize + bc];
+        parallel_for3d(N, C / blksize, H, [&](int n, int c, int h) {
+            for (int w = 0; w < W; ++w) {
+                const int off =
+                        n * C * H * W + c * H * W * blksize +
+                        h * W * blksize + w * blksize;
+                auto o = &output[off];
+                for (int bc = 0; bc < blksize; ++bc) {
+                    o[bc] += bias[c*blksize + bc];
+                }
             }
-        }
+        });
     }
 }
 
@@ -12,6 +12,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -153,30 +154,30 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
         const size_t data_size = srcMemory0.GetSize() / sizeof(float) / srcMemory0.GetDims()[0] * batchToProcess();
 
         if (op == EltwiseLayer::Prod) {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
+            parallel_for(data_size, [&](size_t i) {
                 dst_ptr[i] = src0_ptr[i] * src1_ptr[i];
+            });
 
             for (int j = 2; j < getParentEdges().size(); j++) {
                 const float *src_ptr = reinterpret_cast<const float *>(getParentEdgeAt(j)->getMemory().GetData()) +
                         getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
+                parallel_for(data_size, [&](size_t i) {
                     dst_ptr[i] = dst_ptr[i] * src_ptr[i];
+                });
             }
         } else if (op == EltwiseLayer::Max)  {
-            #pragma omp parallel for
-            for (int i = 0; i < data_size; i++)
+            parallel_for(data_size, [&](size_t i) {
                 dst_ptr[i] = std::max(src0_ptr[i], src1_ptr[i]);
+            });
 
             for (int j = 2; j < getParentEdges().size(); j++) {
                 const float *src_ptr = reinterpret_cast<const float*>(getParentEdgeAt(j)->getMemory().GetData()) +
                         getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-                #pragma omp parallel for
-                for (int i = 0; i < data_size; i++)
+                parallel_for(data_size, [&](size_t i) {
                     dst_ptr[i] = std::max(dst_ptr[i], src_ptr[i]);
+                });
             }
         }
     }
@@ -142,6 +142,21 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
         if (impls.empty()) {
             THROW_IE_EXCEPTION << "Layer " << getName() << " hasn't available configurations!";
         }
+
+        // An extension marks all the data of a layer as constant if it only reads the dimensions of the inputs.
+        // Such a layer is known to be constant before any descriptor is selected, so nodes which ask for it while
+        // they are initialized (e.g. for in-place decisions) see its output as constant, and it is executed once
+        // when the graph is created.
+        shapeOnly = !getParentEdges().empty() && !supportedPrimitiveDescriptors.empty();
+        for (auto &primitiveDescriptor : supportedPrimitiveDescriptors) {
+            const auto &config = primitiveDescriptor.getConfig();
+            for (const auto &inConf : config.inConfs)
+                shapeOnly = shapeOnly && inConf.constant;
+            for (const auto &outConf : config.outConfs)
+                shapeOnly = shapeOnly && outConf.constant;
+        }
+        if (shapeOnly)
+            constant = ConstantType::Const;
     } else {
         THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
     }
@@ -159,6 +174,8 @@ void MKLDNNGenericNode::createPrimitive() {
 
 void MKLDNNGenericNode::execute(mkldnn::stream strm) {
     if (genericPrimitive) {
+        inputs.clear();
+        outputs.clear();
         for (size_t i = 0; i < getParentEdges().size(); i++) {
             auto& mklMemory = getParentEdgeAt(i)->getMemory();
             inputs.push_back(MKLDNNExtensionUtils::MKLMemoryToGenericMemory(mklMemory));
@@ -201,19 +218,36 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
+bool MKLDNNGenericNode::blobsBound(int batch) const {
+    if (batch != boundBatch || boundData.size() != getParentEdges().size() + getChildEdges().size())
+        return false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (boundData[i] != getParentEdgeAt(i)->getMemory().GetData())
+            return false;
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        if (boundData[getParentEdges().size() + i] != getChildEdgeAt(i)->getMemory().GetData())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGenericNode::bindBlobs(int batch) {
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    inputBlobs.clear();
+    outputBlobs.clear();
+    boundData.clear();
     std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::TensorDesc> outputDescs;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        inputs.push_back(getParentEdgeAt(i)->getBlob());
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
+        inputBlobs.push_back(getParentEdgeAt(i)->getBlob());
+        boundData.push_back(getParentEdgeAt(i)->getMemory().GetData());
+        if (isDynBatch && dynBatchLim >= inputBlobs[inputBlobs.size() - 1]->getTensorDesc().getDims()[0]) {
             isDynBatch = false;
         } else {
             // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
+            inputDescs.push_back(inputBlobs[inputBlobs.size() - 1]->getTensorDesc());
+            inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batch);
         }
     }
 
@@ -224,27 +258,35 @@ void MKLDNNGenericNode::execLayer() {
     }
 
     if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
+        for (size_t i = 0; i < inputBlobs.size(); i++) {
+            auto td = inputBlobs[i]->getTensorDesc();
             td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
+            inputBlobs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         if (isDynBatch) {
             size_t idx = i >= outputDescs.size() ? 0 : i;
             auto td = getChildEdgeAt(i)->getBlob()->getTensorDesc();
             td.setDims(outputDescs[idx].getDims());
-            outputs.push_back(make_blob_with_precision(td, getChildEdgeAt(i)->getMemory().GetData()));
+            outputBlobs.push_back(make_blob_with_precision(td, getChildEdgeAt(i)->getMemory().GetData()));
         } else {
-            outputs.push_back(getChildEdgeAt(i)->getBlob());
+            outputBlobs.push_back(getChildEdgeAt(i)->getBlob());
         }
+        boundData.push_back(getChildEdgeAt(i)->getMemory().GetData());
     }
+    boundBatch = batch;
+}
+
+void MKLDNNGenericNode::execLayer() {
+    int batch = batchToProcess();
+    if (!blobsBound(batch))
+        bindBlobs(batch);
+
     auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
     if (execImpl != nullptr) {
         InferenceEngine::ResponseDesc resp;
-        InferenceEngine::StatusCode rc = execImpl->execute(inputs, outputs, &resp);
+        InferenceEngine::StatusCode rc = execImpl->execute(inputBlobs, outputBlobs, &resp);
         if (rc != InferenceEngine::OK) {
             THROW_IE_EXCEPTION << resp.msg;
         }
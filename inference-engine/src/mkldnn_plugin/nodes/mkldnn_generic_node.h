@@ -31,6 +31,9 @@ public:
 
     void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void initOptimalPrimitiveDescriptor() override;
+    bool isShapeOnly() const override {
+        return shapeOnly;
+    }
 
     void execLayer();
     void cleanup() override;
@@ -46,6 +49,16 @@ private:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> inputs;
     std::vector<InferenceEngine::MKLDNNPlugin::MKLDNNPrimitiveMemory> outputs;
+    bool shapeOnly = false;
+
+    // Blobs passed to the extension layer, they wrap the edge memory and are bound again only if
+    // the memory of an edge moves or the batch to process changes
+    void bindBlobs(int batch);
+    bool blobsBound(int batch) const;
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
+    std::vector<InferenceEngine::Blob::Ptr> outputBlobs;
+    std::vector<const void *> boundData;
+    int boundBatch = -1;
 };
 
 }  // namespace MKLDNNPlugin
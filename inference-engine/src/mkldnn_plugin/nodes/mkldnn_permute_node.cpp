@@ -8,6 +8,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -231,10 +232,9 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
 
         size_t dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
-#pragma omp parallel for
-        for (size_t i = 0; i < dataSize; i++) {
+        parallel_for(dataSize, [&](size_t i) {
             dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
-        }
+        });
     }
 }
 
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -133,10 +134,9 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
         const auto* src_data = srcBlbPtr->cbuffer().as<const float *>();
         auto* dst_data = dstBlbPtr->buffer().as<float *>();
 
-#   pragma omp parallel for
-        for (size_t i = 0; i < data_size; i++) {
+        InferenceEngine::parallel_for(data_size, [&](size_t i) {
             dst_data[dstBlbPtr->getTensorDesc().offset(i)] = src_data[srcBlbPtr->getTensorDesc().offset(i)];
-        }
+        });
     }
 }
 
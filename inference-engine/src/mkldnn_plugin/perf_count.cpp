@@ -0,0 +1,163 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+#include <algorithm>
+#include <limits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+uint64_t threadCpuTimeUs() {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        return 0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    // FILETIME is measured in 100 ns intervals
+    return (k.QuadPart + u.QuadPart) / 10;
+#else
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+unsigned bucketIndex(uint64_t us) {
+    if (us < 4)
+        return static_cast<unsigned>(us);
+
+    unsigned order = 0;
+    for (uint64_t v = us; v > 1; v >>= 1) order++;
+    unsigned sub = static_cast<unsigned>(us >> (order - 2)) & 3;
+    return std::min(4 * (order - 1) + sub, PerfCount::histogramBuckets - 1);
+}
+
+uint64_t bucketLowerBound(unsigned idx) {
+    if (idx < 4)
+        return idx;
+
+    unsigned order = idx / 4 + 1;
+    return static_cast<uint64_t>(4 + idx % 4) << (order - 2);
+}
+
+}  // namespace
+
+void PerfCount::add(uint64_t wallUs, uint64_t cpuUs) {
+    duration.fetch_add(wallUs, std::memory_order_relaxed);
+    cpuDuration.fetch_add(cpuUs, std::memory_order_relaxed);
+    histogram[bucketIndex(wallUs)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t prev = minDuration.load(std::memory_order_relaxed);
+    while (wallUs < prev && !minDuration.compare_exchange_weak(prev, wallUs, std::memory_order_relaxed)) {}
+    prev = maxDuration.load(std::memory_order_relaxed);
+    while (wallUs > prev && !maxDuration.compare_exchange_weak(prev, wallUs, std::memory_order_relaxed)) {}
+
+    num.fetch_add(1, std::memory_order_release);
+}
+
+void PerfCount::reset() {
+    num.store(0, std::memory_order_relaxed);
+    duration.store(0, std::memory_order_relaxed);
+    cpuDuration.store(0, std::memory_order_relaxed);
+    minDuration.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    maxDuration.store(0, std::memory_order_relaxed);
+    for (auto &bucket : histogram)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+PerfCount::Statistics PerfCount::statistics() const {
+    Statistics stats;
+
+    uint64_t n = num.load(std::memory_order_acquire);
+    if (n == 0)
+        return stats;
+
+    stats.count = n;
+    stats.avg = duration.load(std::memory_order_relaxed) / n;
+    stats.cpuAvg = cpuDuration.load(std::memory_order_relaxed) / n;
+    stats.min = minDuration.load(std::memory_order_relaxed);
+    stats.max = maxDuration.load(std::memory_order_relaxed);
+    if (stats.min > stats.max) stats.min = stats.max;
+
+    uint32_t counts[histogramBuckets];
+    uint64_t total = 0;
+    for (unsigned i = 0; i < histogramBuckets; i++) {
+        counts[i] = histogram[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    // Samples may be added while the histogram is read, so ranks are taken from its own total
+    auto percentile = [&](unsigned p) -> uint64_t {
+        uint64_t rank = std::max<uint64_t>(1, (total * p + 99) / 100);
+        uint64_t seen = 0;
+        for (unsigned i = 0; i < histogramBuckets; i++) {
+            if (counts[i] == 0) continue;
+            if (seen + counts[i] >= rank) {
+                uint64_t lo = bucketLowerBound(i);
+                uint64_t hi = i + 1 < histogramBuckets ? bucketLowerBound(i + 1) : stats.max + 1;
+                uint64_t value = lo + (hi - lo) * (rank - seen - 1) / counts[i];
+                return std::min(std::max(value, stats.min), stats.max);
+            }
+            seen += counts[i];
+        }
+        return stats.max;
+    };
+
+    stats.p50 = percentile(50);
+    stats.p90 = percentile(90);
+    stats.p99 = percentile(99);
+    return stats;
+}
+
+void PerfCount::fill(InferenceEngine::InferenceEngineProfileInfo &info) const {
+    Statistics stats = statistics();
+    // TODO: Why time counter is signed?
+    info.realTime_uSec = static_cast<long long>(stats.avg);
+    info.cpu_uSec = static_cast<long long>(stats.cpuAvg ? stats.cpuAvg : stats.avg);
+    info.status = stats.count > 0 && info.realTime_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                                             : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+    info.count = stats.count;
+    info.min_uSec = static_cast<long long>(stats.min);
+    info.max_uSec = static_cast<long long>(stats.max);
+    info.p50_uSec = static_cast<long long>(stats.p50);
+    info.p90_uSec = static_cast<long long>(stats.p90);
+    info.p99_uSec = static_cast<long long>(stats.p99);
+}
+
+PerfHelper::PerfHelper(PerfCount &count, PerfCount *extra, bool cpuTime, bool enable)
+        : counter(count), extraCounter(extra), measureCpu(cpuTime), enabled(enable) {
+    if (!enabled)
+        return;
+    __cpuStart = measureCpu ? threadCpuTimeUs() : 0;
+    __start = std::chrono::steady_clock::now();
+}
+
+PerfHelper::~PerfHelper() {
+    if (!enabled)
+        return;
+    auto __finish = std::chrono::steady_clock::now();
+    uint64_t wall = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+    uint64_t cpu = measureCpu ? threadCpuTimeUs() - __cpuStart : 0;
+
+    counter.add(wall, cpu);
+    if (extraCounter)
+        extraCounter->add(wall, cpu);
+}
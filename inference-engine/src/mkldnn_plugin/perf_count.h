@@ -5,46 +5,82 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <ie_common.h>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Accumulates execution times of a node or a request stage. Wall times are kept in a fixed-bucket
+ * histogram with 4 buckets per power of two microseconds, so percentiles are known within 25%
+ * without storing the samples. All the fields are atomic, so the counter may be read and reset
+ * while other threads are adding new samples.
+ */
 class PerfCount {
-    uint64_t duration;
-    uint32_t num;
+public:
+    static constexpr unsigned histogramBuckets = 4 * 28;
+
+    struct Statistics {
+        uint64_t count = 0;
+        uint64_t avg = 0;
+        uint64_t cpuAvg = 0;
+        uint64_t min = 0;
+        uint64_t max = 0;
+        uint64_t p50 = 0;
+        uint64_t p90 = 0;
+        uint64_t p99 = 0;
+    };
+
+    PerfCount() { reset(); }
+    PerfCount(const PerfCount &) = delete;
+    PerfCount &operator=(const PerfCount &) = delete;
+
+    uint64_t avg() const {
+        uint64_t n = num.load(std::memory_order_relaxed);
+        return (n == 0) ? 0 : duration.load(std::memory_order_relaxed) / n;
+    }
 
-    std::chrono::high_resolution_clock::time_point __start;
-    std::chrono::high_resolution_clock::time_point __finish;
+    Statistics statistics() const;
 
-public:
-    PerfCount(): duration(0), num(0) {}
+    void reset();
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    /** Stores the counter to the profiling info of a layer, status is NOT_RUN if it has no samples */
+    void fill(InferenceEngine::InferenceEngineProfileInfo &info) const;
 
 private:
-    void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
-    }
+    void add(uint64_t wallUs, uint64_t cpuUs);
 
-    void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
-        num++;
-    }
+    std::atomic<uint64_t> duration;
+    std::atomic<uint64_t> cpuDuration;
+    std::atomic<uint64_t> num;
+    std::atomic<uint64_t> minDuration;
+    std::atomic<uint64_t> maxDuration;
+    std::atomic<uint32_t> histogram[histogramBuckets];
 
     friend class PerfHelper;
 };
 
+/**
+ * Measures the lifetime of the helper and adds it to the counter. An optional second counter gets the same
+ * sample, e.g. the per request copy of a node counter. Thread CPU time is measured only if requested,
+ * since it costs a system call. A disabled helper doesn't read the clocks, so it is held on the stack
+ * whether the counters are collected or not.
+ */
 class PerfHelper {
     PerfCount &counter;
+    PerfCount *extraCounter;
+    bool measureCpu;
+    bool enabled;
+
+    std::chrono::steady_clock::time_point __start;
+    uint64_t __cpuStart;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, PerfCount *extra = nullptr, bool cpuTime = false, bool enable = true);
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper();
 };
 
 }  // namespace MKLDNNPlugin
-
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
@@ -0,0 +1,104 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+namespace InferenceEngine {
+namespace Benchmarks {
+
+namespace {
+
+const int repetitions = 5;
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedNs(Clock::time_point start) {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+void writeJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+}  // namespace
+
+BenchmarkRegistry &BenchmarkRegistry::instance() {
+    static BenchmarkRegistry registry;
+    return registry;
+}
+
+BenchmarkResult runBenchmark(const BenchmarkCase &benchmark, double minTimeSeconds) {
+    auto kernel = benchmark.setup();
+
+    // Warm-up call, it also estimates the number of calls per repetition
+    auto start = Clock::now();
+    kernel();
+    double firstNs = std::max(elapsedNs(start), 1.0);
+    double repetitionNs = minTimeSeconds * 1e9 / repetitions;
+    size_t callsPerRepetition = std::max<size_t>(1, static_cast<size_t>(repetitionNs / firstNs));
+
+    std::vector<double> perCallNs;
+    size_t iterations = 0;
+    for (int r = 0; r < repetitions; r++) {
+        start = Clock::now();
+        for (size_t i = 0; i < callsPerRepetition; i++)
+            kernel();
+        perCallNs.push_back(elapsedNs(start) / callsPerRepetition);
+        iterations += callsPerRepetition;
+    }
+    std::sort(perCallNs.begin(), perCallNs.end());
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.params = benchmark.params;
+    result.iterations = iterations;
+    result.minNs = perCallNs.front();
+    result.medianNs = perCallNs[perCallNs.size() / 2];
+    result.bytes = benchmark.bytes;
+    result.elements = benchmark.elements;
+    return result;
+}
+
+void printResults(const std::vector<BenchmarkResult> &results, std::ostream &out) {
+    out << std::left << std::setw(32) << "benchmark" << std::setw(40) << "params"
+        << std::right << std::setw(12) << "median us" << std::setw(12) << "min us"
+        << std::setw(10) << "GB/s" << std::setw(14) << "Melem/s" << std::endl;
+    for (const auto &r : results) {
+        out << std::left << std::setw(32) << r.name << std::setw(40) << r.params << std::right << std::fixed
+            << std::setprecision(2) << std::setw(12) << r.medianNs / 1000 << std::setw(12) << r.minNs / 1000
+            << std::setw(10) << r.gbPerSecond() << std::setw(14) << r.elementsPerSecond() / 1e6 << std::endl;
+    }
+}
+
+void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &out) {
+    out << "[" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &r = results[i];
+        out << "  {\"name\": ";
+        writeJsonString(out, r.name);
+        out << ", \"params\": ";
+        writeJsonString(out, r.params);
+        out << std::fixed << std::setprecision(1)
+            << ", \"iterations\": " << r.iterations
+            << ", \"median_ns\": " << r.medianNs
+            << ", \"min_ns\": " << r.minNs
+            << std::setprecision(3)
+            << ", \"gb_per_s\": " << r.gbPerSecond()
+            << ", \"elements_per_s\": " << std::setprecision(0) << r.elementsPerSecond() << "}"
+            << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    out << "]" << std::endl;
+}
+
+}  // namespace Benchmarks
+}  // namespace InferenceEngine
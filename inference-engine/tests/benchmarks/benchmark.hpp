@@ -0,0 +1,82 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Benchmarks {
+
+/**
+ * A single benchmark case: a kernel with fixed parameters. The amount of memory traffic and the number of
+ * processed elements per call are used to report GB/s and elements per second.
+ */
+struct BenchmarkCase {
+    std::string name;
+    std::string params;
+    double bytes;
+    double elements;
+    /** Prepares the inputs and returns the function which is timed */
+    std::function<std::function<void()>()> setup;
+};
+
+struct BenchmarkResult {
+    std::string name;
+    std::string params;
+    size_t iterations;
+    double minNs;
+    double medianNs;
+    double bytes;
+    double elements;
+
+    double gbPerSecond() const { return medianNs > 0 ? bytes / medianNs : 0; }
+    double elementsPerSecond() const { return medianNs > 0 ? elements * 1e9 / medianNs : 0; }
+};
+
+class BenchmarkRegistry {
+public:
+    static BenchmarkRegistry &instance();
+
+    void add(const BenchmarkCase &benchmark) { cases.push_back(benchmark); }
+
+    const std::vector<BenchmarkCase> &all() const { return cases; }
+
+private:
+    std::vector<BenchmarkCase> cases;
+};
+
+/**
+ * Runs the case for about minTimeSeconds after one warm-up call. The time is split into repetitions,
+ * the median time per call over the repetitions is reported as the result, so a preempted repetition
+ * doesn't distort it.
+ */
+BenchmarkResult runBenchmark(const BenchmarkCase &benchmark, double minTimeSeconds);
+
+void printResults(const std::vector<BenchmarkResult> &results, std::ostream &out);
+
+/** Writes the results as JSON, the output of two builds can be compared with a line diff */
+void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &out);
+
+/**
+ * Registers the benchmarks of a kernel during static initialization
+ */
+struct BenchmarkRegistrar {
+    explicit BenchmarkRegistrar(const std::function<void(BenchmarkRegistry &)> &registerCases) {
+        registerCases(BenchmarkRegistry::instance());
+    }
+};
+
+}  // namespace Benchmarks
+}  // namespace InferenceEngine
+
+#define IE_BENCHMARK_CONCAT(x, y) IE_BENCHMARK_CONCAT_EVAL(x, y)
+#define IE_BENCHMARK_CONCAT_EVAL(x, y) x ## y
+
+#define REGISTER_BENCHMARKS(registerFunction) \
+    static ::InferenceEngine::Benchmarks::BenchmarkRegistrar IE_BENCHMARK_CONCAT(__benchmark_registrar_, __LINE__)(registerFunction)
@@ -0,0 +1,221 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <ie_layers.h>
+#include <ext_list.hpp>
+#include "benchmark.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Benchmarks;
+
+namespace {
+
+Layout planarLayout(size_t rank) {
+    switch (rank) {
+        case 1: return C;
+        case 2: return NC;
+        case 3: return CHW;
+        default: return NCHW;
+    }
+}
+
+size_t product(const SizeVector &dims) {
+    size_t n = 1;
+    for (auto d : dims) n *= d;
+    return n;
+}
+
+/**
+ * Instantiates a layer of the CPU extensions library with one of its supported configurations
+ * and owns the input and output blobs of that configuration
+ */
+class ExtensionLayer {
+public:
+    ExtensionLayer(const std::string &type, const std::map<std::string, std::string> &params,
+                   const std::vector<SizeVector> &inDims, const std::vector<SizeVector> &outDims, bool blocked)
+            : layer(LayerParams{type, type, Precision::FP32}) {
+        layer.params = params;
+        for (size_t i = 0; i < inDims.size(); i++) {
+            data.emplace_back(new Data("in" + std::to_string(i),
+                                       TensorDesc(Precision::FP32, inDims[i], planarLayout(inDims[i].size()))));
+            layer.insData.push_back(data.back());
+        }
+        for (size_t i = 0; i < outDims.size(); i++) {
+            layer.outData.emplace_back(new Data("out" + std::to_string(i),
+                                                TensorDesc(Precision::FP32, outDims[i], planarLayout(outDims[i].size()))));
+        }
+
+        ResponseDesc resp;
+        Extensions::Cpu::CpuExtensions extensions;
+        ILayerImplFactory *factory = nullptr;
+        if (extensions.getFactoryFor(factory, &layer, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        std::unique_ptr<ILayerImplFactory> factoryHolder(factory);
+
+        std::vector<ILayerImpl::Ptr> impls;
+        if (factory->getImplementations(impls, &resp) != OK || impls.empty())
+            THROW_IE_EXCEPTION << "No implementations for " << type << ": " << resp.msg;
+        impl = std::dynamic_pointer_cast<ILayerExecImpl>(impls[0]);
+        if (!impl)
+            THROW_IE_EXCEPTION << "Implementation of " << type << " is not executable";
+
+        std::vector<LayerConfig> configs;
+        if (impl->getSupportedConfigurations(configs, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        LayerConfig *selected = nullptr;
+        for (auto &config : configs) {
+            bool isBlocked = false;
+            for (auto &port : config.inConfs)
+                isBlocked |= port.desc.getBlockingDesc().getOrder().size() > port.desc.getDims().size();
+            if (isBlocked == blocked) {
+                selected = &config;
+                break;
+            }
+        }
+        if (selected == nullptr)
+            THROW_IE_EXCEPTION << type << " has no " << (blocked ? "blocked" : "planar") << " configuration";
+        if (impl->init(*selected, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+
+        std::mt19937 generator(0);
+        for (auto &port : selected->inConfs)
+            inputs.push_back(allocate(port.desc, generator));
+        for (auto &port : selected->outConfs)
+            outputs.push_back(allocate(port.desc, generator));
+    }
+
+    void execute() {
+        ResponseDesc resp;
+        if (impl->execute(inputs, outputs, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+    }
+
+    float *input(size_t i) { return inputs[i]->buffer().as<float *>(); }
+
+private:
+    static Blob::Ptr allocate(const TensorDesc &desc, std::mt19937 &generator) {
+        TensorDesc blobDesc = desc.getLayout() == ANY
+                              ? TensorDesc(Precision::FP32, desc.getDims(), planarLayout(desc.getDims().size()))
+                              : desc;
+        auto blob = make_shared_blob<float>(blobDesc);
+        blob->allocate();
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        float *ptr = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ptr[i] = distribution(generator);
+        return blob;
+    }
+
+    std::vector<DataPtr> data;
+    CNNLayer layer;
+    std::shared_ptr<ILayerExecImpl> impl;
+    std::vector<Blob::Ptr> inputs;
+    std::vector<Blob::Ptr> outputs;
+};
+
+std::string shapeString(const SizeVector &dims) {
+    std::string str;
+    for (size_t i = 0; i < dims.size(); i++)
+        str += (i ? "x" : "") + std::to_string(dims[i]);
+    return str;
+}
+
+void registerDetectionOutput(BenchmarkRegistry &registry) {
+    struct Shape { size_t batch, priors, classes; };
+    for (const auto &shape : std::vector<Shape>{{1, 8732, 21}, {1, 24564, 81}, {8, 8732, 21}}) {
+        std::string params = "N=" + std::to_string(shape.batch) + " priors=" + std::to_string(shape.priors)
+                             + " classes=" + std::to_string(shape.classes);
+        double elements = static_cast<double>(shape.batch * shape.priors * shape.classes);
+        double bytes = sizeof(float) * (shape.batch * shape.priors * (4 + shape.classes) + 2 * shape.priors * 4);
+        registry.add({"DetectionOutput", params, bytes, elements, [shape]() {
+            std::map<std::string, std::string> params = {
+                    {"num_classes", std::to_string(shape.classes)}, {"background_label_id", "0"},
+                    {"top_k", "400"}, {"keep_top_k", "200"}, {"nms_threshold", "0.45"},
+                    {"confidence_threshold", "0.01"}, {"share_location", "1"},
+                    {"code_type", "caffe.PriorBoxParameter.CENTER_SIZE"}};
+            size_t keepTopK = 200;
+            auto layer = std::make_shared<ExtensionLayer>(
+                    "DetectionOutput", params,
+                    std::vector<SizeVector>{{shape.batch, shape.priors * 4},
+                                            {shape.batch, shape.priors * shape.classes},
+                                            {1, 2, shape.priors * 4}},
+                    std::vector<SizeVector>{{1, 1, shape.batch * keepTopK, 7}}, false);
+
+            // Confidences are in [0, 1) like after softmax, priors are valid boxes followed by variances
+            std::mt19937 generator(1);
+            std::uniform_real_distribution<float> unit(0.f, 1.f);
+            float *conf = layer->input(1);
+            for (size_t i = 0; i < shape.batch * shape.priors * shape.classes; i++)
+                conf[i] = unit(generator) * unit(generator) * unit(generator);
+            float *priors = layer->input(2);
+            for (size_t p = 0; p < shape.priors; p++) {
+                float cx = unit(generator), cy = unit(generator);
+                float w = 0.05f + 0.3f * unit(generator), h = 0.05f + 0.3f * unit(generator);
+                priors[p * 4 + 0] = cx - w / 2;
+                priors[p * 4 + 1] = cy - h / 2;
+                priors[p * 4 + 2] = cx + w / 2;
+                priors[p * 4 + 3] = cy + h / 2;
+                float *variances = priors + shape.priors * 4 + p * 4;
+                variances[0] = variances[1] = 0.1f;
+                variances[2] = variances[3] = 0.2f;
+            }
+            return [layer]() { layer->execute(); };
+        }});
+    }
+}
+
+void registerResample(BenchmarkRegistry &registry) {
+    for (const std::string type : {"NEAREST", "LINEAR"}) {
+        for (bool blocked : {false, true}) {
+            if (blocked && type != "NEAREST") continue;
+            for (const auto &dims : std::vector<SizeVector>{{1, 256, 38, 38}, {1, 64, 150, 150}}) {
+                SizeVector outDims = {dims[0], dims[1], dims[2] * 2, dims[3] * 2};
+                std::string params = type + (blocked ? " blocked " : " planar ") + shapeString(dims) + " x2";
+                double elements = static_cast<double>(product(outDims));
+                double bytes = sizeof(float) * static_cast<double>(product(dims) + product(outDims));
+                registry.add({"Resample", params, bytes, elements, [type, blocked, dims, outDims]() {
+                    auto layer = std::make_shared<ExtensionLayer>(
+                            "Resample", std::map<std::string, std::string>{
+                                    {"type", "caffe.ResampleParameter." + type}, {"antialias", "0"},
+                                    {"factor", "2"}},
+                            std::vector<SizeVector>{dims}, std::vector<SizeVector>{outDims}, blocked);
+                    return [layer]() { layer->execute(); };
+                }});
+            }
+        }
+    }
+}
+
+void registerMVN(BenchmarkRegistry &registry) {
+    for (bool blocked : {false, true}) {
+        for (int acrossChannels : {0, 1}) {
+            for (const auto &dims : std::vector<SizeVector>{{1, 64, 128, 128}, {8, 256, 32, 32}}) {
+                std::string params = std::string(blocked ? "blocked " : "planar ") +
+                                     (acrossChannels ? "across " : "per_channel ") + shapeString(dims);
+                double elements = static_cast<double>(product(dims));
+                double bytes = 2 * sizeof(float) * elements;
+                registry.add({"MVN", params, bytes, elements, [blocked, acrossChannels, dims]() {
+                    auto layer = std::make_shared<ExtensionLayer>(
+                            "MVN", std::map<std::string, std::string>{
+                                    {"across_channels", std::to_string(acrossChannels)},
+                                    {"normalize_variance", "1"}, {"eps", "1e-9"}},
+                            std::vector<SizeVector>{dims}, std::vector<SizeVector>{dims}, blocked);
+                    return [layer]() { layer->execute(); };
+                }});
+            }
+        }
+    }
+}
+
+}  // namespace
+
+REGISTER_BENCHMARKS(registerDetectionOutput);
+REGISTER_BENCHMARKS(registerResample);
+REGISTER_BENCHMARKS(registerMVN);
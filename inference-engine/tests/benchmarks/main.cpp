@@ -0,0 +1,95 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ie_parallel.hpp"
+#include "benchmark.hpp"
+
+using namespace InferenceEngine::Benchmarks;
+
+namespace {
+
+void showUsage() {
+    std::cout << "InferenceEngineKernelBenchmarks [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --help                  Print a usage message." << std::endl;
+    std::cout << "    --list                  List the benchmark cases and exit." << std::endl;
+    std::cout << "    --filter=<substring>    Run only the cases whose name or parameters contain the substring." << std::endl;
+    std::cout << "    --min_time=<seconds>    Measurement time per case (default 0.5)." << std::endl;
+    std::cout << "    --json=<path>           Store the results to a JSON file." << std::endl;
+}
+
+bool startsWith(const std::string &str, const std::string &prefix) {
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    std::string filter, jsonPath;
+    double minTime = 0.5;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            showUsage();
+            return 0;
+        } else if (arg == "--list") {
+            listOnly = true;
+        } else if (startsWith(arg, "--filter=")) {
+            filter = arg.substr(9);
+        } else if (startsWith(arg, "--min_time=")) {
+            minTime = std::atof(arg.substr(11).c_str());
+        } else if (startsWith(arg, "--json=")) {
+            jsonPath = arg.substr(7);
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            showUsage();
+            return 1;
+        }
+    }
+
+    std::vector<const BenchmarkCase *> selected;
+    for (const auto &benchmark : BenchmarkRegistry::instance().all()) {
+        if (filter.empty() || (benchmark.name + " " + benchmark.params).find(filter) != std::string::npos)
+            selected.push_back(&benchmark);
+    }
+
+    if (listOnly) {
+        for (auto benchmark : selected)
+            std::cout << benchmark->name << " " << benchmark->params << std::endl;
+        return 0;
+    }
+
+    std::cout << "Threads: " << parallel_get_max_threads() << std::endl;
+    std::vector<BenchmarkResult> results;
+    try {
+        for (auto benchmark : selected) {
+            std::cout << "Running " << benchmark->name << " " << benchmark->params << std::endl;
+            results.push_back(runBenchmark(*benchmark, minTime));
+        }
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << std::endl;
+    printResults(results, std::cout);
+
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        if (!json.good()) {
+            std::cerr << "Failed to create " << jsonPath << std::endl;
+            return 1;
+        }
+        writeJson(results, json);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "memory_solver.hpp"
+#include "benchmark.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Benchmarks;
+
+namespace {
+
+/** Unrolled recurrent like topology: short living boxes with a long living one every 100 boxes */
+std::vector<MemorySolver::Box> makeBoxes(int num, int maxLive) {
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> live(0, maxLive);
+    std::uniform_int_distribution<int> size(1, 64);
+    std::vector<MemorySolver::Box> boxes;
+    for (int i = 0; i < num; i++)
+        boxes.push_back({i, i % 100 ? i + live(generator) : i + num / 4, size(generator), i});
+    return boxes;
+}
+
+void registerMemorySolver(BenchmarkRegistry &registry) {
+    struct Strategy { MemorySolver::Strategy value; const char *name; };
+    const std::vector<Strategy> strategies = {
+            {MemorySolver::Strategy::BY_SIZE, "by_size"}, {MemorySolver::Strategy::BY_LIFETIME, "by_lifetime"},
+            {MemorySolver::Strategy::BEST_FIT, "best_fit"}, {MemorySolver::Strategy::BEST, "best"}};
+
+    for (const auto &strategy : strategies) {
+        for (int num : {1000, 20000}) {
+            std::string params = std::string(strategy.name) + " boxes=" + std::to_string(num);
+            registry.add({"MemorySolver", params, 0, static_cast<double>(num), [strategy, num]() {
+                auto boxes = std::make_shared<std::vector<MemorySolver::Box>>(makeBoxes(num, 16));
+                return [boxes, strategy]() {
+                    MemorySolver solver(*boxes);
+                    solver.solve(strategy.value);
+                };
+            }});
+        }
+    }
+}
+
+}  // namespace
+
+REGISTER_BENCHMARKS(registerMemorySolver);
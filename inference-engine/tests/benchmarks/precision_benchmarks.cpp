@@ -0,0 +1,51 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "precision_utils.h"
+#include "benchmark.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Benchmarks;
+
+namespace {
+
+struct ConversionBuffers {
+    explicit ConversionBuffers(size_t size) : f32(size), f16(size) {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+        for (size_t i = 0; i < size; i++) {
+            f32[i] = distribution(generator);
+            f16[i] = PrecisionUtils::f32tof16(f32[i]);
+        }
+    }
+
+    std::vector<float> f32;
+    std::vector<ie_fp16> f16;
+};
+
+void registerPrecisionConversions(BenchmarkRegistry &registry) {
+    for (size_t size : {size_t(1) << 12, size_t(1) << 20, size_t(1) << 24}) {
+        std::string params = "elements=" + std::to_string(size);
+        double bytes = static_cast<double>(size * (sizeof(float) + sizeof(ie_fp16)));
+
+        registry.add({"f16tof32Arrays", params, bytes, static_cast<double>(size), [size]() {
+            auto buffers = std::make_shared<ConversionBuffers>(size);
+            return [buffers, size]() { PrecisionUtils::f16tof32Arrays(buffers->f32.data(), buffers->f16.data(), size); };
+        }});
+
+        registry.add({"f32tof16Arrays", params, bytes, static_cast<double>(size), [size]() {
+            auto buffers = std::make_shared<ConversionBuffers>(size);
+            return [buffers, size]() { PrecisionUtils::f32tof16Arrays(buffers->f16.data(), buffers->f32.data(), size); };
+        }});
+    }
+}
+
+}  // namespace
+
+REGISTER_BENCHMARKS(registerPrecisionConversions);
@@ -0,0 +1,95 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <ie_blob.h>
+#include "ie_preprocess_data.hpp"
+#include "blob_transform.hpp"
+#include "benchmark.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Benchmarks;
+
+namespace {
+
+template<typename T>
+Blob::Ptr makeBlob(Precision precision, Layout layout, const SizeVector &dims, bool fill) {
+    auto blob = make_shared_blob<T>(TensorDesc(precision, dims, layout));
+    blob->allocate();
+    if (fill) {
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<int> distribution(0, 255);
+        T *ptr = blob->buffer().template as<T *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ptr[i] = static_cast<T>(distribution(generator));
+    }
+    return blob;
+}
+
+Blob::Ptr makeBlob(Precision precision, Layout layout, const SizeVector &dims, bool fill) {
+    return precision == Precision::FP32 ? makeBlob<float>(precision, layout, dims, fill)
+                                        : makeBlob<uint8_t>(precision, layout, dims, fill);
+}
+
+std::string shapeString(const SizeVector &dims) {
+    std::string str;
+    for (size_t i = 0; i < dims.size(); i++)
+        str += (i ? "x" : "") + std::to_string(dims[i]);
+    return str;
+}
+
+void registerResize(BenchmarkRegistry &registry) {
+    struct Shape { SizeVector in, out; };
+    const std::vector<Shape> shapes = {
+            {{1, 3, 1080, 1920}, {1, 3, 224, 224}},
+            {{1, 3, 480, 640}, {1, 3, 300, 300}},
+            {{1, 3, 224, 224}, {1, 3, 448, 448}}};
+
+    for (auto algorithm : {RESIZE_BILINEAR, RESIZE_AREA}) {
+        for (Precision precision : {Precision::U8, Precision::FP32}) {
+            for (const auto &shape : shapes) {
+                std::string params = std::string(algorithm == RESIZE_BILINEAR ? "bilinear " : "area ") +
+                                     precision.name() + " " + shapeString(shape.in) + "->" + shapeString(shape.out);
+                double inElements = static_cast<double>(shape.in[0] * shape.in[1] * shape.in[2] * shape.in[3]);
+                double outElements = static_cast<double>(shape.out[0] * shape.out[1] * shape.out[2] * shape.out[3]);
+                double bytes = (inElements + outElements) * precision.size();
+                registry.add({"Resize", params, bytes, outElements, [algorithm, precision, shape]() {
+                    auto preprocess = std::make_shared<PreProcessData>();
+                    preprocess->setRoiBlob(makeBlob(precision, NCHW, shape.in, true));
+                    auto out = makeBlob(precision, NCHW, shape.out, false);
+                    return [preprocess, out, algorithm]() mutable { preprocess->execute(out, algorithm); };
+                }});
+            }
+        }
+    }
+}
+
+void registerBlobCopy(BenchmarkRegistry &registry) {
+    const std::vector<SizeVector> shapes = {{1, 3, 224, 224}, {1, 64, 56, 56}, {8, 3, 300, 300}};
+
+    for (Precision precision : {Precision::U8, Precision::FP32}) {
+        for (auto layouts : {std::make_pair(NCHW, NHWC), std::make_pair(NHWC, NCHW)}) {
+            for (const auto &dims : shapes) {
+                std::string params = std::string(precision.name()) + (layouts.first == NCHW ? " NCHW->NHWC " : " NHWC->NCHW ")
+                                     + shapeString(dims);
+                double elements = static_cast<double>(dims[0] * dims[1] * dims[2] * dims[3]);
+                double bytes = 2 * elements * precision.size();
+                registry.add({"blob_copy_4d", params, bytes, elements, [precision, layouts, dims]() {
+                    auto src = makeBlob(precision, layouts.first, dims, true);
+                    auto dst = makeBlob(precision, layouts.second, dims, false);
+                    return [src, dst]() { blob_copy(src, dst); };
+                }});
+            }
+        }
+    }
+}
+
+}  // namespace
+
+REGISTER_BENCHMARKS(registerResize);
+REGISTER_BENCHMARKS(registerBlobCopy);
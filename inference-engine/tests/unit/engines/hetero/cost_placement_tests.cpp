@@ -0,0 +1,200 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cpp/ie_cnn_net_reader.h>
+#include <cost_placement.h>
+
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class CostPlacementTests : public ::testing::Test {
+protected:
+    CNNNetReader netReader;
+    LayerCosts costs;
+    std::map<std::string, std::set<std::string>> supportedLayers;
+
+    // Input "in" followed by a chain of ReLU layers "A", "B"... passing 1MB to each other
+    void createChain(size_t length) {
+        std::string dims = "<dim>1</dim><dim>1</dim><dim>512</dim><dim>512</dim>";
+        std::string layers = R"V0G0N(
+        <layer id="0" name="in" precision="FP32" type="Input">
+            <output><port id="0">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>)V0G0N";
+        std::string edges;
+        for (size_t i = 1; i <= length; i++) {
+            std::string id = std::to_string(i);
+            layers += R"V0G0N(
+        <layer id=")V0G0N" + id + R"V0G0N(" name=")V0G0N" + std::string(1, 'A' + i - 1) +
+                      R"V0G0N(" precision="FP32" type="ReLU">
+            <input><port id="0">)V0G0N" + dims + R"V0G0N(</port></input>
+            <output><port id="1">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>)V0G0N";
+            edges += R"V0G0N(
+        <edge from-layer=")V0G0N" + std::to_string(i - 1) + R"V0G0N(" from-port=")V0G0N" +
+                     (i == 1 ? "0" : "1") + R"V0G0N(" to-layer=")V0G0N" + id + R"V0G0N(" to-port="0"/>)V0G0N";
+        }
+        std::string model = R"V0G0N(
+<net name="Chain" version="2" batch="1">
+    <layers>)V0G0N" + layers + R"V0G0N(
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+        ASSERT_NO_THROW(netReader.ReadNetwork(model.data(), model.length()));
+        ASSERT_TRUE(netReader.isParseSuccess());
+    }
+
+    void setCosts(const std::string &device, const std::vector<double> &micros) {
+        for (size_t i = 0; i < micros.size(); i++) {
+            std::string layer(1, 'A' + i);
+            costs.set(device, layer, micros[i]);
+            supportedLayers[device].insert(layer);
+        }
+    }
+
+    double place(double transferMicrosPerMB, size_t maxSegments = 0) {
+        return placeByCost(netReader.getNetwork(), {"GPU", "CPU"}, supportedLayers, costs,
+                           transferMicrosPerMB, maxSegments);
+    }
+
+    std::string affinity(const std::string &layer) {
+        return netReader.getNetwork().getLayerByName(layer.c_str())->affinity;
+    }
+};
+
+TEST_F(CostPlacementTests, placesEachLayerOnFastestDeviceIfTransfersAreFree) {
+    createChain(3);
+    setCosts("GPU", {10, 10, 10});
+    setCosts("CPU", {5, 100, 5});
+
+    ASSERT_DOUBLE_EQ(20, place(0));
+    ASSERT_EQ("CPU", affinity("A"));
+    ASSERT_EQ("GPU", affinity("B"));
+    ASSERT_EQ("CPU", affinity("C"));
+    ASSERT_EQ("CPU", affinity("in"));
+}
+
+TEST_F(CostPlacementTests, keepsLayersTogetherIfTransfersCostMoreThanTheyGain) {
+    createChain(3);
+    setCosts("GPU", {10, 10, 10});
+    setCosts("CPU", {5, 100, 5});
+
+    // The fastest device of each layer gives 20us of execution and two 1MB transfers
+    ASSERT_DOUBLE_EQ(30, place(1000));
+    for (auto &&layer : {"in", "A", "B", "C"}) {
+        ASSERT_EQ("GPU", affinity(layer)) << layer;
+    }
+}
+
+TEST_F(CostPlacementTests, limitsNumberOfSegments) {
+    createChain(3);
+    setCosts("GPU", {10, 10, 10});
+    setCosts("CPU", {5, 100, 5});
+
+    ASSERT_DOUBLE_EQ(25, place(0, 2));
+    size_t segments = 1;
+    for (auto &&pair : {std::make_pair("A", "B"), std::make_pair("B", "C")}) {
+        if (affinity(pair.first) != affinity(pair.second))
+            segments++;
+    }
+    ASSERT_EQ(2, segments);
+}
+
+TEST_F(CostPlacementTests, unsupportedLayerForcesDevice) {
+    createChain(3);
+    setCosts("GPU", {10, 10, 10});
+    setCosts("CPU", {50, 50, 50});
+    supportedLayers["GPU"].erase("B");
+
+    ASSERT_DOUBLE_EQ(150, place(1000));
+    for (auto &&layer : {"A", "B", "C"}) {
+        ASSERT_EQ("CPU", affinity(layer)) << layer;
+    }
+
+    // With cheap transfers only the unsupported layer leaves the faster device
+    ASSERT_DOUBLE_EQ(70 + 2 * 10, place(10));
+    ASSERT_EQ("GPU", affinity("A"));
+    ASSERT_EQ("CPU", affinity("B"));
+    ASSERT_EQ("GPU", affinity("C"));
+}
+
+TEST_F(CostPlacementTests, layerWithoutCostCostsAsMuchAsOnSlowestDevice) {
+    createChain(1);
+    costs.set("CPU", "A", 100);
+    supportedLayers["GPU"].insert("A");
+    supportedLayers["CPU"].insert("A");
+
+    ASSERT_DOUBLE_EQ(100, place(0));
+    // equal costs are decided by the order of the devices
+    ASSERT_EQ("GPU", affinity("A"));
+}
+
+TEST_F(CostPlacementTests, layerNotSupportedByAnyDeviceIsLeftWithoutAffinity) {
+    createChain(2);
+    setCosts("CPU", {5, 5});
+    supportedLayers["CPU"].erase("B");
+
+    ASSERT_DOUBLE_EQ(5, place(0));
+    ASSERT_EQ("CPU", affinity("A"));
+    ASSERT_EQ("", affinity("B"));
+}
+
+TEST_F(CostPlacementTests, throwsIfLayersDontFitIntoSegments) {
+    createChain(3);
+    setCosts("GPU", {10, 10, 10});
+    setCosts("CPU", {5, 5, 5});
+    supportedLayers["GPU"].erase("A");
+    supportedLayers["GPU"].erase("C");
+    supportedLayers["CPU"].erase("B");
+
+    ASSERT_THROW(place(0, 2), details::InferenceEngineException);
+    ASSERT_DOUBLE_EQ(20, place(0, 3));
+}
+
+TEST(LayerCostsTests, saveAndLoadKeepCosts) {
+    LayerCosts costs;
+    costs.set("CPU", "conv1", 12.5);
+    costs.set("CPU", "conv 2/relu", 0);
+    costs.set("GPU", "conv1", 3.25);
+
+    std::stringstream stream;
+    costs.save(stream);
+    LayerCosts loaded;
+    loaded.load(stream);
+
+    ASSERT_TRUE(loaded.hasDevice("CPU"));
+    ASSERT_TRUE(loaded.hasDevice("GPU"));
+    ASSERT_FALSE(loaded.hasDevice("FPGA"));
+    double micros = -1;
+    ASSERT_TRUE(loaded.get("CPU", "conv1", micros));
+    ASSERT_DOUBLE_EQ(12.5, micros);
+    ASSERT_TRUE(loaded.get("CPU", "conv 2/relu", micros));
+    ASSERT_DOUBLE_EQ(0, micros);
+    ASSERT_TRUE(loaded.get("GPU", "conv1", micros));
+    ASSERT_DOUBLE_EQ(3.25, micros);
+    ASSERT_FALSE(loaded.get("GPU", "conv 2/relu", micros));
+}
+
+TEST(LayerCostsTests, loadSkipsMalformedLines) {
+    std::stringstream stream("CPU 10 conv1\n\nGPU fast conv1\nGPU 5\nCPU 7 pool1\n");
+    LayerCosts costs;
+    costs.load(stream);
+
+    double micros = -1;
+    ASSERT_TRUE(costs.get("CPU", "conv1", micros));
+    ASSERT_DOUBLE_EQ(10, micros);
+    ASSERT_TRUE(costs.get("CPU", "pool1", micros));
+    ASSERT_DOUBLE_EQ(7, micros);
+    ASSERT_FALSE(costs.hasDevice("GPU"));
+}
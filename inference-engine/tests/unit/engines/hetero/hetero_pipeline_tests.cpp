@@ -0,0 +1,366 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <gmock/gmock-generated-actions.h>
+#include <gmock/gmock-more-actions.h>
+#include <gmock/gmock-actions.h>
+#include <mock_iexecutable_network.hpp>
+#include <mock_iasync_infer_request.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+#include <cpp_interfaces/ie_task_synchronizer.hpp>
+#include <hetero_pipeline.h>
+#include <hetero_infer_request.h>
+#include <hetero_async_infer_request.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace HeteroPlugin;
+
+class HeteroPipelineTests : public ::testing::Test {
+protected:
+    // Tasks of the stages refer to the members, so the pipeline is destroyed first
+    HeteroPipeline::Ptr pipeline;
+    std::mutex mutex;
+    std::condition_variable condVar;
+    std::promise<void> release;
+    std::shared_future<void> released;
+    // Requests passed to the second stage and completed by it
+    size_t accepted = 0;
+    size_t completed = 0;
+
+    virtual void TearDown() {
+        try {
+            release.set_value();
+        } catch (const std::future_error &) {}
+        pipeline.reset();
+    }
+
+    virtual void SetUp() {
+        released = release.get_future().share();
+    }
+
+    void waitFor(const std::function<bool()> &condition) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(condVar.wait_for(lock, std::chrono::seconds(10), condition));
+    }
+
+    void notify() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condVar.notify_all();
+    }
+
+    // The first stage passes the request to the second one, which waits until the test releases it
+    void submitBlockedRequest() {
+        pipeline->submit(0, std::make_shared<Task>([this]() {
+            pipeline->submit(1, std::make_shared<Task>([this]() {
+                released.wait();
+                pipeline->stageDone(1, std::chrono::microseconds(0));
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    completed++;
+                }
+                notify();
+            }));
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                accepted++;
+            }
+            pipeline->stageDone(0, std::chrono::microseconds(0));
+            notify();
+        }));
+    }
+};
+
+TEST_F(HeteroPipelineTests, throwsOnSubmitToMissingStage) {
+    pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU"}, 1);
+    ASSERT_EQ(2, pipeline->size());
+    ASSERT_THROW(pipeline->submit(2, std::make_shared<Task>([]() {})), InferenceEngineException);
+}
+
+TEST_F(HeteroPipelineTests, stagesKeepOrderOfRequests) {
+    const size_t requests = 16;
+    pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU", "CPU"}, 2);
+    std::vector<std::vector<size_t>> order(pipeline->size());
+
+    std::function<void(size_t, size_t)> runStage = [&](size_t stage, size_t request) {
+        if (stage + 1 < pipeline->size()) {
+            pipeline->submit(stage + 1, std::make_shared<Task>([&, stage, request]() {
+                runStage(stage + 1, request);
+            }));
+        }
+        pipeline->stageDone(stage, std::chrono::microseconds(10));
+        std::unique_lock<std::mutex> lock(mutex);
+        order[stage].push_back(request);
+        condVar.notify_all();
+    };
+
+    for (size_t request = 0; request < requests; request++) {
+        pipeline->submit(0, std::make_shared<Task>([&, request]() { runStage(0, request); }));
+    }
+    waitFor([&]() { return order.back().size() == requests; });
+    // the tasks refer to the locals
+    pipeline.reset();
+
+    for (auto &&stageOrder : order) {
+        ASSERT_EQ(requests, stageOrder.size());
+        for (size_t request = 0; request < requests; request++) {
+            ASSERT_EQ(request, stageOrder[request]);
+        }
+    }
+}
+
+TEST_F(HeteroPipelineTests, statisticsCountRequestsAndBusyTime) {
+    pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU"}, 1);
+    for (size_t request = 0; request < 3; request++) {
+        pipeline->submit(0, std::make_shared<Task>([this]() {
+            pipeline->stageDone(0, std::chrono::microseconds(100));
+            notify();
+        }));
+    }
+    waitFor([&]() { return pipeline->getStatistics()[0].requests == 3; });
+
+    auto statistics = pipeline->getStatistics();
+    ASSERT_EQ(2, statistics.size());
+    ASSERT_EQ("CPU", statistics[0].device);
+    ASSERT_EQ("GPU", statistics[1].device);
+    ASSERT_EQ(300, statistics[0].busyTime);
+    ASSERT_EQ(0, statistics[1].requests);
+    ASSERT_EQ(0, statistics[1].busyTime);
+}
+
+TEST_F(HeteroPipelineTests, nextStageHoldsQueueSizePlusOneRequests) {
+    const size_t requests = 6;
+    const size_t queueSize = 2;
+    pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU"}, queueSize);
+
+    for (size_t request = 0; request < requests; request++) {
+        submitBlockedRequest();
+    }
+
+    // One request runs on the second stage and queueSize of them wait for it, the first stage is blocked
+    waitFor([&]() { return accepted == queueSize + 1; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_EQ(queueSize + 1, accepted);
+        ASSERT_EQ(0, completed);
+    }
+    ASSERT_EQ(queueSize + 1, pipeline->getStatistics()[0].requests);
+
+    release.set_value();
+    waitFor([&]() { return completed == requests; });
+    ASSERT_EQ(requests, accepted);
+}
+
+TEST_F(HeteroPipelineTests, blockedTimeIsAccountedToPreviousStage) {
+    pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU"}, 0);
+
+    submitBlockedRequest();
+    submitBlockedRequest();
+
+    // The second request waits until the first one leaves the second stage
+    waitFor([&]() { return accepted == 1; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(0, pipeline->getStatistics()[0].blockedTime);
+    release.set_value();
+    waitFor([&]() { return completed == 2; });
+
+    auto statistics = pipeline->getStatistics();
+    ASSERT_GE(statistics[0].blockedTime, 40000);
+    ASSERT_EQ(0, statistics[1].blockedTime);
+}
+
+class HeteroAsyncInferRequestTests : public ::testing::Test {
+protected:
+    std::vector<std::shared_ptr<MockIExecutableNetwork>> mockNetworks;
+    std::vector<std::shared_ptr<MockIInferRequest>> mockRequests;
+    std::map<std::string, Blob::Ptr> blobs;
+    HeteroPipeline::Ptr pipeline;
+    HeteroInferRequest::Ptr heteroRequest;
+    HeteroAsyncInferRequest::Ptr request;
+
+    std::mutex mutex;
+    std::vector<size_t> inferred;
+
+    virtual void TearDown() {
+        request.reset();
+        for (auto &&mockRequest : mockRequests) {
+            EXPECT_TRUE(Mock::VerifyAndClearExpectations(mockRequest.get()));
+        }
+    }
+
+    virtual void SetUp() {
+        // in -> subgraph1 -> mid -> subgraph2 -> out
+        std::vector<std::pair<std::string, std::string>> subgraphs = {{"in", "mid"}, {"mid", "out"}};
+        HeteroInferRequest::SubRequestsList subRequests;
+        for (size_t i = 0; i < subgraphs.size(); i++) {
+            auto mockNetwork = make_shared<MockIExecutableNetwork>();
+            auto mockRequest = make_shared<MockIInferRequest>();
+            EXPECT_CALL(*mockNetwork, CreateInferRequest(_, _))
+                    .WillOnce(DoAll(SetArgReferee<0>(mockRequest), Return(OK)));
+            EXPECT_CALL(*mockRequest, GetBlob(_, _, _)).WillRepeatedly(
+                    Invoke([this](const char *name, Blob::Ptr &blob, ResponseDesc *) {
+                        blob = getBlob(name);
+                        return OK;
+                    }));
+            EXPECT_CALL(*mockRequest, SetBlob(_, _, _)).WillRepeatedly(Return(OK));
+            EXPECT_CALL(*mockRequest, Infer(_)).WillRepeatedly(Invoke([this, i](ResponseDesc *) {
+                std::unique_lock<std::mutex> lock(mutex);
+                inferred.push_back(i);
+                return OK;
+            }));
+            mockNetworks.push_back(mockNetwork);
+            mockRequests.push_back(mockRequest);
+
+            HeteroInferRequest::SubRequestDesc desc;
+            desc._device = i == 0 ? "CPU" : "GPU";
+            desc._network = std::make_shared<ExecutableNetwork>(mockNetwork);
+            desc._iNames = {subgraphs[i].first};
+            desc._oNames = {subgraphs[i].second};
+            subRequests.push_back(desc);
+        }
+
+        InputsDataMap inputs;
+        inputs["in"] = nullptr;
+        OutputsDataMap outputs;
+        outputs["out"] = nullptr;
+        pipeline = std::make_shared<HeteroPipeline>(std::vector<std::string>{"CPU", "GPU"}, 1);
+        heteroRequest = std::make_shared<HeteroInferRequest>(inputs, outputs, subRequests, pipeline);
+        request = std::make_shared<HeteroAsyncInferRequest>(heteroRequest,
+                                                            std::make_shared<TaskExecutor>(),
+                                                            std::make_shared<TaskSynchronizer>(),
+                                                            std::make_shared<TaskExecutor>(),
+                                                            pipeline);
+    }
+
+    // "<copy: name>" counter of a plugin which reports whether it copied the blob or used it as is
+    void setCopyCounter(size_t subgraph, const std::string &name, unsigned long long bytes) {
+        InferenceEngineProfileInfo info;
+        info.status = bytes ? InferenceEngineProfileInfo::EXECUTED : InferenceEngineProfileInfo::OPTIMIZED_OUT;
+        info.realTime_uSec = info.cpu_uSec = 0;
+        info.execution_index = 0;
+        std::string execType = "memcpy: " + std::to_string(bytes) + " bytes";
+        execType.copy(info.exec_type, sizeof(info.exec_type) - 1);
+        std::map<std::string, InferenceEngineProfileInfo> perfMap;
+        perfMap["<copy: " + name + ">"] = info;
+        EXPECT_CALL(*mockRequests[subgraph], GetPerformanceCounts(_, _))
+                .WillRepeatedly(DoAll(SetArgReferee<0>(perfMap), Return(OK)));
+    }
+
+    InferenceEngineProfileInfo getEdgeCounter(const std::string &name) {
+        std::map<std::string, InferenceEngineProfileInfo> perfMap;
+        heteroRequest->GetPerformanceCounts(perfMap);
+        auto it = perfMap.find("<edge " + name + ">");
+        EXPECT_NE(perfMap.end(), it);
+        return it != perfMap.end() ? it->second : InferenceEngineProfileInfo();
+    }
+
+    Blob::Ptr getBlob(const std::string &name) {
+        auto &blob = blobs[name];
+        if (!blob) {
+            blob = make_shared_blob<float>(Precision::FP32, Layout::C, {16});
+            blob->allocate();
+        }
+        return blob;
+    }
+};
+
+TEST_F(HeteroAsyncInferRequestTests, waitReturnsNotStartedBeforeFirstRun) {
+    ASSERT_EQ(INFER_NOT_STARTED, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(HeteroAsyncInferRequestTests, inferRunsSubgraphsInOrder) {
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_EQ((std::vector<size_t>{0, 1, 0, 1}), inferred);
+    ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+    ASSERT_EQ(2, pipeline->getStatistics()[1].requests);
+}
+
+TEST_F(HeteroAsyncInferRequestTests, waitReportsRunInProgress) {
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    EXPECT_CALL(*mockRequests[1], Infer(_)).WillOnce(Invoke([&](ResponseDesc *) {
+        released.wait();
+        return OK;
+    }));
+
+    ASSERT_NO_THROW(request->StartAsync());
+    ASSERT_EQ(RESULT_NOT_READY, request->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+    ASSERT_EQ(RESULT_NOT_READY, request->Wait(10));
+    ASSERT_THROW(request->StartAsync(), InferenceEngineException);
+
+    release.set_value();
+    ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(HeteroAsyncInferRequestTests, waitRethrowsExceptionOfStage) {
+    EXPECT_CALL(*mockRequests[0], Infer(_))
+            .WillOnce(Return(GENERAL_ERROR))
+            .WillRepeatedly(Return(OK));
+    EXPECT_CALL(*mockRequests[1], Infer(_)).WillOnce(Return(OK));
+
+    // The failed stage doesn't pass the run to the next one
+    ASSERT_NO_THROW(request->StartAsync());
+    ASSERT_THROW(request->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+    ASSERT_THROW(request->Wait(IInferRequest::WaitMode::STATUS_ONLY), InferenceEngineException);
+    auto statistics = pipeline->getStatistics();
+    ASSERT_EQ(1, statistics[0].requests);
+    ASSERT_EQ(0, statistics[1].requests);
+
+    // The next run clears the exception
+    ASSERT_NO_THROW(request->StartAsync());
+    ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(HeteroAsyncInferRequestTests, inferThrowsExceptionOfLastStage) {
+    EXPECT_CALL(*mockRequests[1], Infer(_)).WillOnce(Return(GENERAL_ERROR));
+
+    ASSERT_THROW(request->Infer(), InferenceEngineException);
+    ASSERT_EQ(1, pipeline->getStatistics()[1].requests);
+}
+
+TEST_F(HeteroAsyncInferRequestTests, edgeIsSharedIfNoEndCopiedIt) {
+    setCopyCounter(0, "mid", 0);
+    setCopyCounter(1, "mid", 0);
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_NO_THROW(request->Infer());
+
+    auto edge = getEdgeCounter("mid");
+    ASSERT_STREQ("HeteroEdge", edge.layer_type);
+    ASSERT_STREQ("shared: 0 bytes", edge.exec_type);
+    ASSERT_EQ(2, edge.count);
+    ASSERT_EQ(0, edge.execution_index);
+}
+
+TEST_F(HeteroAsyncInferRequestTests, edgeCountsBytesReportedByEnds) {
+    setCopyCounter(0, "mid", 0);
+    setCopyCounter(1, "mid", 128);
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_NO_THROW(request->Infer());
+
+    ASSERT_STREQ("copy: 128 bytes", getEdgeCounter("mid").exec_type);
+}
+
+TEST_F(HeteroAsyncInferRequestTests, edgeIsCopiedByEndsWhichDontReportCopies) {
+    setCopyCounter(0, "mid", 0);
+    EXPECT_CALL(*mockRequests[1], GetPerformanceCounts(_, _)).WillRepeatedly(Return(OK));
+    ASSERT_NO_THROW(request->Infer());
+    ASSERT_NO_THROW(request->Infer());
+
+    // The subgraph is taken as copying the whole blob in each inference
+    auto bytes = 2 * getBlob("mid")->byteSize();
+    ASSERT_EQ("copy: " + std::to_string(bytes) + " bytes", std::string(getEdgeCounter("mid").exec_type));
+}
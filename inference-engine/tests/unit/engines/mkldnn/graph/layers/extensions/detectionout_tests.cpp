@@ -0,0 +1,332 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include <cmath>
+#include <random>
+#include <numeric>
+#include <algorithm>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct detection_output_test_params {
+    size_t n;
+    int num_classes;
+    int num_priors;
+
+    int share_location;
+    int top_k;
+    int keep_top_k;
+    float nms_threshold;
+    float confidence_threshold;
+    std::string code_type;
+};
+
+struct ref_detection {
+    float conf;
+    int label;
+    int idx;
+};
+
+static float ref_overlap(const float *bbox1, const float *bbox2) {
+    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1])
+        return 0.0f;
+
+    float intersect_width = std::min(bbox1[2], bbox2[2]) - std::max(bbox1[0], bbox2[0]);
+    float intersect_height = std::min(bbox1[3], bbox2[3]) - std::max(bbox1[1], bbox2[1]);
+    if (intersect_width <= 0 || intersect_height <= 0)
+        return 0.0f;
+
+    float intersect_size = intersect_width * intersect_height;
+    float bbox1_size = (bbox1[2] - bbox1[0]) * (bbox1[3] - bbox1[1]);
+    float bbox2_size = (bbox2[2] - bbox2[0]) * (bbox2[3] - bbox2[1]);
+    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+}
+
+// Caffe DetectionOutput for normalized priors and background label 0, image by image and class by class
+void ref_detection_output(const float *loc_data, const float *conf_data, const float *prior_data,
+                          InferenceEngine::TBlob<float> &dst, detection_output_test_params prm) {
+    float *dst_data = dst.data();
+    std::fill(dst_data, dst_data + dst.size(), 0.f);
+
+    const int N = static_cast<int>(prm.n);
+    const int C = prm.num_classes;
+    const int P = prm.num_priors;
+    const int L = prm.share_location ? 1 : C;
+    const float *variances = prior_data + P * 4;
+
+    int count = 0;
+    for (int n = 0; n < N; n++) {
+        std::vector<float> boxes(L * P * 4);
+        for (int l = 0; l < L; l++) {
+            for (int p = 0; p < P; p++) {
+                const float *prior = prior_data + p * 4;
+                const float *loc = loc_data + ((n * P + p) * L + l) * 4;
+                const float *var = variances + p * 4;
+                float *box = &boxes[(l * P + p) * 4];
+                if (prm.code_type == "caffe.PriorBoxParameter.CENTER_SIZE") {
+                    float width = prior[2] - prior[0];
+                    float height = prior[3] - prior[1];
+                    float center_x = var[0] * loc[0] * width + (prior[0] + prior[2]) / 2.0f;
+                    float center_y = var[1] * loc[1] * height + (prior[1] + prior[3]) / 2.0f;
+                    float new_width = std::exp(var[2] * loc[2]) * width;
+                    float new_height = std::exp(var[3] * loc[3]) * height;
+                    box[0] = center_x - new_width / 2.0f;
+                    box[1] = center_y - new_height / 2.0f;
+                    box[2] = center_x + new_width / 2.0f;
+                    box[3] = center_y + new_height / 2.0f;
+                } else {
+                    for (int i = 0; i < 4; i++)
+                        box[i] = prior[i] + var[i] * loc[i];
+                }
+            }
+        }
+
+        std::vector<std::vector<int>> kept(C);
+        for (int c = 1; c < C; c++) {
+            const float *pboxes = &boxes[(prm.share_location ? 0 : c) * P * 4];
+            auto conf = [&](int p) { return conf_data[(n * P + p) * C + c]; };
+
+            std::vector<int> candidates;
+            for (int p = 0; p < P; p++) {
+                if (conf(p) > prm.confidence_threshold)
+                    candidates.push_back(p);
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b) { return conf(a) > conf(b); });
+            if (prm.top_k > -1 && candidates.size() > static_cast<size_t>(prm.top_k))
+                candidates.resize(prm.top_k);
+
+            for (int p : candidates) {
+                bool keep = true;
+                for (int k : kept[c]) {
+                    if (ref_overlap(pboxes + p * 4, pboxes + k * 4) > prm.nms_threshold) {
+                        keep = false;
+                        break;
+                    }
+                }
+                if (keep)
+                    kept[c].push_back(p);
+            }
+        }
+
+        std::vector<ref_detection> detections;
+        for (int c = 1; c < C; c++) {
+            for (int p : kept[c])
+                detections.push_back({conf_data[(n * P + p) * C + c], c, p});
+        }
+        if (prm.keep_top_k > -1 && detections.size() > static_cast<size_t>(prm.keep_top_k)) {
+            std::stable_sort(detections.begin(), detections.end(),
+                             [](const ref_detection &a, const ref_detection &b) { return a.conf > b.conf; });
+            detections.resize(prm.keep_top_k);
+            std::stable_sort(detections.begin(), detections.end(),
+                             [](const ref_detection &a, const ref_detection &b) { return a.label < b.label; });
+        }
+
+        for (auto &detection : detections) {
+            const float *box = &boxes[((prm.share_location ? 0 : detection.label) * P + detection.idx) * 4];
+            float *pdst = dst_data + count * 7;
+            pdst[0] = n;
+            pdst[1] = detection.label;
+            pdst[2] = detection.conf;
+            for (int i = 0; i < 4; i++)
+                pdst[3 + i] = box[i];
+            count++;
+        }
+    }
+
+    if (count < N * prm.keep_top_k)
+        dst_data[count * 7] = -1;
+}
+
+class MKLDNNCPUExtDetectionOutputTests: public TestsCommon, public WithParamInterface<detection_output_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="DetectionOutput_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" id="3" type="DetectionOutput" precision="FP32">
+            <data num_classes="_CLASSES_" background_label_id="0" share_location="_SHARE_" top_k="_TOPK_"
+                  keep_top_k="_KEEPK_" nms_threshold="_NMS_" confidence_threshold="_THRESHOLD_"
+                  code_type="_CODE_TYPE_"/>
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OUT_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(detection_output_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IN_", p.n);
+        REPLACE_WITH_NUM(model, "_LOC_", p.num_priors * (p.share_location ? 1 : p.num_classes) * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", p.num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_PRIORS_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_OUT_", p.n * p.keep_top_k);
+
+        REPLACE_WITH_NUM(model, "_CLASSES_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_SHARE_", p.share_location);
+        REPLACE_WITH_NUM(model, "_TOPK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KEEPK_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_threshold);
+        REPLACE_WITH_NUM(model, "_THRESHOLD_", p.confidence_threshold);
+        REPLACE_WITH_STR(model, "_CODE_TYPE_", p.code_type);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            detection_output_test_params p = ::testing::WithParamInterface<detection_output_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::BlobMap srcs;
+            for (auto &&input : net_reader.getNetwork().getInputsInfo()) {
+                InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+                src->allocate();
+                srcs[input.first] = src;
+            }
+            float *loc_data = srcs["loc"]->buffer();
+            float *conf_data = srcs["conf"]->buffer();
+            float *prior_data = srcs["priors"]->buffer();
+
+            // Priors of different sizes all over the image, so that many of them overlap
+            std::mt19937 generator(1);
+            std::uniform_real_distribution<float> unit(0.f, 1.f);
+            for (int i = 0; i < p.num_priors; i++) {
+                float cx = unit(generator), cy = unit(generator);
+                float w = 0.05f + 0.3f * unit(generator), h = 0.05f + 0.3f * unit(generator);
+                prior_data[i * 4 + 0] = cx - w / 2;
+                prior_data[i * 4 + 1] = cy - h / 2;
+                prior_data[i * 4 + 2] = cx + w / 2;
+                prior_data[i * 4 + 3] = cy + h / 2;
+                float *variances = prior_data + p.num_priors * 4 + i * 4;
+                variances[0] = variances[1] = 0.1f;
+                variances[2] = variances[3] = 0.2f;
+            }
+            for (size_t i = 0; i < srcs["loc"]->size(); i++) {
+                loc_data[i] = sin(0.37f * i);
+            }
+            // Distinct confidences, so that the order of the detections doesn't depend on the sort
+            size_t conf_size = srcs["conf"]->size();
+            std::vector<int> order(conf_size);
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), generator);
+            for (size_t i = 0; i < conf_size; i++) {
+                conf_data[i] = (order[i] + 0.5f) / conf_size;
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_detection_output(loc_data, conf_data, prior_data, dst_ref, p);
+            compare(*output, dst_ref, 1e-5f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtDetectionOutputTests, TestsDetectionOutput) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detection_output_test_params{1, 5, 100, 1, -1, 200, 0.45f, 0.01f, "caffe.PriorBoxParameter.CENTER_SIZE"},
+                // top_k limits the boxes of a class before NMS, keep_top_k the boxes of an image after it
+                detection_output_test_params{2, 5, 100, 1, 10, 30, 0.45f, 0.01f, "caffe.PriorBoxParameter.CENTER_SIZE"},
+                detection_output_test_params{3, 5, 100, 0, -1, 20, 0.45f, 0.01f, "caffe.PriorBoxParameter.CENTER_SIZE"},
+                detection_output_test_params{2, 21, 67, 0, 20, 100, 0.3f, 0.01f, "caffe.PriorBoxParameter.CORNER"},
+                // Fewer detections than keep_top_k for all the images, the list is terminated by -1
+                detection_output_test_params{4, 5, 100, 1, 400, 50, 0.45f, 0.97f, "caffe.PriorBoxParameter.CORNER"},
+                detection_output_test_params{2, 5, 100, 0, -1, 50, 0.45f, 0.95f, "caffe.PriorBoxParameter.CENTER_SIZE"}));
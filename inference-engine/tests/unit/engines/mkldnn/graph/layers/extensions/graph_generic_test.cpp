@@ -1280,6 +1280,17 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithDynamicBatch) {
     ref_double_batch1(*srcPtr, dst_ref2);
 
     compare(*output, dst_ref2);
+
+    // blobs of the layer are bound again for the whole batch
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "2"}});
+
+    for (size_t i = 0; i < output->size(); i++) {
+        dstData[i] = 0;
+    }
+
+    graph.Infer(srcs, outputBlobs);
+
+    compare(*output, dst_ref);
 }
 
 TEST_F(MKLDNNGraphGenericTests, ExecuteNotInLineGRN) {
@@ -1556,3 +1567,104 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteInLineGRN) {
 
     compare(*output, *dstOut);
 }
+
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithNewBlobsInEachInference) {
+    std::string model = R"V0G0N(
+<net name="default" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="resample" type="Resample" precision="FP32" id="1">
+            <data type="caffe.ResampleParameter.NEAREST" antialias="0" factor="2"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>)V0G0N";
+    std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(cpuExt);
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    // The copies are counted with the performance counters only
+    MKLDNNPlugin::Config config;
+    config.collectPerfCounters = true;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, extMgr));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::TensorDesc srcDesc(InferenceEngine::Precision::FP32, {1, 2, 3, 4}, InferenceEngine::NCHW);
+    InferenceEngine::TensorDesc dstDesc(InferenceEngine::Precision::FP32, {1, 2, 6, 8}, InferenceEngine::NCHW);
+
+    // Both blobs become the memory of the graph, so the layer works on new buffers in each inference
+    std::vector<InferenceEngine::Blob::Ptr> outputs;
+    std::vector<std::vector<float>> refs;
+    for (size_t i = 0; i < 3; i++) {
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(srcDesc);
+        src->allocate();
+        float *src_data = src->buffer();
+        for (size_t j = 0; j < src->size(); j++) {
+            src_data[j] = static_cast<float>(i * 100 + j);
+        }
+        InferenceEngine::Blob::Ptr output = InferenceEngine::make_shared_blob<float>(dstDesc);
+        output->allocate();
+
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("resample", output, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+
+        std::vector<float> ref(output->size());
+        for (size_t c = 0; c < 2; c++) {
+            for (size_t y = 0; y < 6; y++) {
+                for (size_t x = 0; x < 8; x++) {
+                    ref[(c * 6 + y) * 8 + x] = src_data[(c * 3 + y / 2) * 4 + x / 2];
+                }
+            }
+        }
+        outputs.push_back(output);
+        refs.push_back(ref);
+    }
+
+    // The outputs of the previous inferences are not overwritten
+    for (size_t i = 0; i < outputs.size(); i++) {
+        compare(outputs[i]->buffer().as<float *>(), refs[i].data(), refs[i].size(), 0.0f);
+    }
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+    for (const std::string name : {"data", "resample"}) {
+        auto it = perfMap.find("<copy: " + name + ">");
+        ASSERT_NE(perfMap.end(), it) << name;
+        ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT, it->second.status) << name;
+    }
+}
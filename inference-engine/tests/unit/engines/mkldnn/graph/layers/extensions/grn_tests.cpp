@@ -0,0 +1,265 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include <cmath>
+#include <limits>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct grn_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    float bias;
+
+    size_t num_prim_desc;
+    bool isBlockedFormat;
+    int selectedType;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+template <typename data_t>
+void ref_grn(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TBlob<data_t> &dst, grn_test_params prm) {
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    size_t N = prm.in.n;
+    size_t C = prm.in.c;
+    size_t H = prm.in.h;
+    size_t W = prm.in.w;
+
+    for (int b = 0; b < N; b++) {
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+                double variance = 0;
+                for (int c = 0; c < C; c++) {
+                    variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
+                }
+                variance = std::pow(variance + prm.bias, 0.5f);
+                for (int c = 0; c < C; c++) {
+                    dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / variance;
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtGRNTests: public TestsCommon, public WithParamInterface<grn_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="GRN_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="grn" id="2" type="GRN" precision="FP32">
+            <data bias="_BIAS_"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(grn_test_params p) {
+        std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_BIAS_", p.bias);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            grn_test_params p = ::testing::WithParamInterface<grn_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            nodes = graph.getNodes();
+
+            MKLDNNPlugin::MKLDNNNodePtr layer;
+            for (auto &node : nodes) {
+                if (node->getName() == "grn") {
+                    layer = node;
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                    // The layer takes the layout of the fake layer, so that the blocked code is tested
+                    auto blk_dims = node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getBlockingDesc().getBlockDims();
+                    ASSERT_EQ(p.isBlockedFormat ? 5 : 4, blk_dims.size());
+                }
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            if (p.isBlockedFormat) {
+                // A reorder after the layer zeroes the padding of its input, so the nodes are executed up to the layer
+                // to check that it sets padding channels of the last block to zero. They are filled with NaN before.
+                graph.PushInputData("in1", src, -1);
+                InferenceEngine::Blob::Ptr layerOutput = layer->getChildEdgeAt(0)->getBlob();
+                InferenceEngine::SizeVector blk_dims = layerOutput->getTensorDesc().getBlockingDesc().getBlockDims();
+                const size_t CB = blk_dims[1], HW = blk_dims[2] * blk_dims[3], blk_size = blk_dims[4];
+                float *data = layerOutput->buffer().as<float *>();
+
+                mkldnn::stream strm(mkldnn::stream::kind::eager);
+                for (auto &node : nodes) {
+                    if (node == layer) {
+                        for (size_t n = 0; n < blk_dims[0]; n++)
+                            for (size_t hw = 0; hw < HW; hw++)
+                                for (size_t c = p.in.c - (CB - 1) * blk_size; c < blk_size; c++)
+                                    data[((n * CB + CB - 1) * HW + hw) * blk_size + c] = std::numeric_limits<float>::quiet_NaN();
+                    }
+                    if (!node->isConstant())
+                        node->execute(strm);
+                    if (node == layer)
+                        break;
+                }
+
+                for (size_t n = 0; n < blk_dims[0]; n++) {
+                    for (size_t hw = 0; hw < HW; hw++) {
+                        for (size_t c = p.in.c - (CB - 1) * blk_size; c < blk_size; c++) {
+                            ASSERT_EQ(0.0f, data[((n * CB + CB - 1) * HW + hw) * blk_size + c]) << "channel " << c;
+                        }
+                    }
+                }
+            }
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_grn(*srcPtr, dst_ref, p);
+            compare(*output, dst_ref, 1e-5f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtGRNTests, TestsGRN) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGRN, MKLDNNCPUExtGRNTests,
+        ::testing::Values(
+                // Less than a block of channels and a partially filled last block
+                grn_test_params{{2,  3, 15, 15}, 1.f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                grn_test_params{{2, 17, 15, 15}, 1.f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                grn_test_params{{1, 17,  7, 9}, 0.01f, 3, false, MKLDNNPlugin::impl_desc_type::unknown },
+                grn_test_params{{2,  3, 15, 15}, 1.f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                grn_test_params{{2, 17, 15, 15}, 1.f, 3, true, MKLDNNPlugin::impl_desc_type::unknown },
+                grn_test_params{{1, 17,  7, 9}, 0.01f, 3, true, MKLDNNPlugin::impl_desc_type::unknown }));
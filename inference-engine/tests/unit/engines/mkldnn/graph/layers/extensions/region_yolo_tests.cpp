@@ -0,0 +1,227 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mock_mkldnn_primitive.hpp"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include <cmath>
+#include <algorithm>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct region_yolo_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    int classes;
+    int coords;
+    int num;
+    int do_softmax;
+    std::string mask;
+
+    // Bound of the error of the exp approximations used by the layer
+    float max_diff;
+};
+
+static float ref_logistic(float x) {
+    return 1.f / (1.f + std::exp(-x));
+}
+
+void ref_region_yolo(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst,
+                     region_yolo_test_params prm) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    int B = static_cast<int>(prm.in.n);
+    int IC = static_cast<int>(prm.in.c);
+    int spatial = static_cast<int>(prm.in.h * prm.in.w);
+
+    for (int i = 0; i < B * IC * spatial; i++) {
+        dst_data[i] = src_data[i];
+    }
+
+    int num = prm.do_softmax ? prm.num : static_cast<int>(std::count(prm.mask.begin(), prm.mask.end(), ',') + 1);
+    int entries = prm.coords + prm.classes + 1;
+    int logistic_entries = prm.do_softmax ? 1 : prm.classes + 1;
+
+    for (int b = 0; b < B; b++) {
+        for (int n = 0; n < num; n++) {
+            const float *psrc = src_data + (b * num + n) * entries * spatial;
+            float *pdst = dst_data + (b * num + n) * entries * spatial;
+
+            for (int i = 0; i < 2 * spatial; i++) {
+                pdst[i] = ref_logistic(psrc[i]);
+            }
+            for (int i = prm.coords * spatial; i < (prm.coords + logistic_entries) * spatial; i++) {
+                pdst[i] = ref_logistic(psrc[i]);
+            }
+
+            if (!prm.do_softmax)
+                continue;
+
+            for (int i = 0; i < spatial; i++) {
+                const float *pclasses = psrc + (prm.coords + 1) * spatial + i;
+                float *pdst_classes = pdst + (prm.coords + 1) * spatial + i;
+
+                double max = pclasses[0];
+                for (int c = 0; c < prm.classes; c++) {
+                    max = std::max(max, static_cast<double>(pclasses[c * spatial]));
+                }
+                double sum = 0;
+                for (int c = 0; c < prm.classes; c++) {
+                    sum += std::exp(pclasses[c * spatial] - max);
+                }
+                for (int c = 0; c < prm.classes; c++) {
+                    pdst_classes[c * spatial] = static_cast<float>(std::exp(pclasses[c * spatial] - max) / sum);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtRegionYoloTests: public TestsCommon, public WithParamInterface<region_yolo_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="RegionYolo_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="region1" id="1" type="RegionYolo" precision="FP32">
+            <data classes="_CLASSES_" coords="_COORDS_" num="_NUM_" do_softmax="_SOFTMAX_" _MASK_/>
+
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(region_yolo_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_OC_", p.in.c * p.in.h * p.in.w);
+
+        REPLACE_WITH_NUM(model, "_CLASSES_", p.classes);
+        REPLACE_WITH_NUM(model, "_COORDS_", p.coords);
+        REPLACE_WITH_NUM(model, "_NUM_", p.num);
+        REPLACE_WITH_NUM(model, "_SOFTMAX_", p.do_softmax);
+        REPLACE_WITH_STR(model, "_MASK_", p.mask.empty() ? "" : "mask=\"" + p.mask + "\"");
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            region_yolo_test_params p = ::testing::WithParamInterface<region_yolo_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+
+            // Values up to 20 by magnitude, so that both the saturated and the steep parts of the functions are checked
+            float *src_data = src->buffer();
+            for (size_t i = 0; i < src->size(); i++) {
+                src_data[i] = 20.f * sin(0.37f * i);
+            }
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_region_yolo(*srcPtr, dst_ref, p);
+            compare(*output, dst_ref, p.max_diff);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtRegionYoloTests, TestsRegionYolo) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsRegionYolo, MKLDNNCPUExtRegionYoloTests,
+        ::testing::Values(
+                // Yolo v2, the number of positions is not a multiple of the vector size
+                region_yolo_test_params{{1, 125, 13, 13}, 20, 4, 5, 1, "", 1e-5f},
+                region_yolo_test_params{{2, 425, 19, 19}, 80, 4, 5, 1, "", 1e-5f},
+                // Yolo v3
+                region_yolo_test_params{{1, 255, 13, 13}, 80, 4, 9, 0, "6,7,8", 1e-5f},
+                region_yolo_test_params{{2, 255, 26, 26}, 80, 4, 9, 0, "3,4,5", 1e-5f}));
@@ -69,8 +69,8 @@ void ref_resample(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TB
                         float ix = ox * fx + fy / 2.0f - 0.5f;
                         float iy = oy * fy + fx / 2.0f - 0.5f;
 
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+                        int ix_r = std::min(std::max(static_cast<int>(round(ix)), 0), static_cast<int>(IW) - 1);
+                        int iy_r = std::min(std::max(static_cast<int>(round(iy)), 0), static_cast<int>(IH) - 1);
 
                         out_ptr[oy * OW + ox] = in_ptr[iy_r * IW + ix_r];
                     }
@@ -294,19 +294,33 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown }));
+                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 2.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.6f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
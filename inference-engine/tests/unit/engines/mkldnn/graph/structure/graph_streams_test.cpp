@@ -0,0 +1,671 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_weights_cache.h"
+#include "mkldnn_plugin/mkldnn_workspace_group.h"
+#include "mkldnn_plugin/mkldnn_plugin.h"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include "../test_graph.hpp"
+#include <ie_plugin_config.hpp>
+#include <ie_memory_policy.hpp>
+#include <thread>
+#include <chrono>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNTestStreamsExecNetwork: public MKLDNNPlugin::MKLDNNExecNetwork {
+public:
+    MKLDNNTestStreamsExecNetwork(InferenceEngine::ICNNNetwork &network, const MKLDNNPlugin::Config &cfg)
+            : MKLDNNExecNetwork(network, cfg, {}) {}
+
+    size_t getStreamsNumber() const {
+        return streams.size();
+    }
+
+    MKLDNNPlugin::MKLDNNGraph::Ptr getGraph(size_t stream) const {
+        return streams[stream].graph;
+    }
+};
+
+class MKLDNNGraphStreamsTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    // The same convolution followed by pooling, so its output is intermediate data
+    std::string pooledModelTemplate = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>_S_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>_S_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>_S_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer name="pool" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>_S_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>_PS_</dim>
+                    <dim>_PS_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getPooledModel(size_t size) {
+        std::string pooledModel = pooledModelTemplate;
+        REPLACE_WITH_NUM(pooledModel, "_S_", size);
+        REPLACE_WITH_NUM(pooledModel, "_PS_", size / 2);
+        return pooledModel;
+    }
+
+    void readNetwork(InferenceEngine::CNNNetReader &net_reader) {
+        InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr;
+        readNetwork(net_reader, weights_ptr);
+    }
+
+    void readNetwork(InferenceEngine::CNNNetReader &net_reader, InferenceEngine::TBlob<uint8_t>::Ptr &weights_ptr) {
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {448});
+        weights->allocate();
+        fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+        weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+        net_reader.SetWeights(weights_ptr);
+    }
+
+    void infer(MKLDNNPlugin::MKLDNNExecNetwork &execNetwork, const InferenceEngine::Blob::Ptr &src,
+               InferenceEngine::Blob::Ptr &dst, const std::string &output = "conv") {
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork.CreateInferRequest(inferRequest);
+
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::StatusCode sts = inferRequest->SetBlob("data", src, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        sts = inferRequest->Infer(&resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        sts = inferRequest->GetBlob(output.c_str(), dst, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    }
+};
+
+TEST_F(MKLDNNGraphStreamsTests, WeightsCacheCreatesMemoryOnce) {
+    mkldnn::engine eng(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    MKLDNNPlugin::MKLDNNWeightsCache cache;
+
+    size_t created = 0;
+    auto create = [&]() {
+        created++;
+        return MKLDNNPlugin::MKLDNNMemoryPtr(new MKLDNNPlugin::MKLDNNMemory(eng));
+    };
+
+    auto first = cache.findOrCreate("conv_0", create);
+    auto second = cache.findOrCreate("conv_0", create);
+    auto other = cache.findOrCreate("conv_1", create);
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(2, created);
+    ASSERT_EQ(2, cache.size());
+}
+
+TEST_F(MKLDNNGraphStreamsTests, StreamsProduceSameResults) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                           {InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_STREAMS, InferenceEngine::PluginConfigParams::YES},
+                           {InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_REPLICAS,
+                            InferenceEngine::PluginConfigParams::CPU_WEIGHTS_SINGLE}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> execNetwork;
+    ASSERT_NO_THROW(execNetwork.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), config)));
+    ASSERT_EQ(2, execNetwork->getStreamsNumber());
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    MKLDNNPlugin::Config single_config;
+    single_config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> reference;
+    ASSERT_NO_THROW(reference.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), single_config)));
+    ASSERT_EQ(1, reference->getStreamsNumber());
+    reference->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    reference->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    // Requests are distributed in round-robin order, so each of them runs its own copy of the graph
+    InferenceEngine::Blob::Ptr expected, first, second;
+    ASSERT_NO_FATAL_FAILURE(infer(*reference, src, expected));
+    ASSERT_NO_FATAL_FAILURE(infer(*execNetwork, src, first));
+    ASSERT_NO_FATAL_FAILURE(infer(*execNetwork, src, second));
+
+    compare(*expected, *first);
+    compare(*expected, *second);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, WeightsAreSharedOrReplicatedBetweenStreams) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    auto getWeights = [](MKLDNNTestStreamsExecNetwork &execNetwork, size_t stream) {
+        std::vector<void *> weights;
+        for (auto &node : execNetwork.getGraph(stream)->GetNodes()) {
+            if (node->getName() != "conv")
+                continue;
+            for (auto &memory : node->getInternalBlobMemory())
+                weights.push_back(memory->GetData());
+        }
+        return weights;
+    };
+
+    for (auto replicas : {InferenceEngine::PluginConfigParams::CPU_WEIGHTS_SINGLE,
+                          InferenceEngine::PluginConfigParams::CPU_WEIGHTS_PER_NODE}) {
+        MKLDNNPlugin::Config config;
+        config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_STREAMS, InferenceEngine::PluginConfigParams::YES},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_REPLICAS, replicas}});
+
+        std::shared_ptr<MKLDNNTestStreamsExecNetwork> execNetwork;
+        ASSERT_NO_THROW(execNetwork.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), config)));
+        ASSERT_EQ(2, execNetwork->getStreamsNumber());
+
+        auto first = getWeights(*execNetwork, 0);
+        auto second = getWeights(*execNetwork, 1);
+        ASSERT_EQ(2, first.size());
+        ASSERT_EQ(first.size(), second.size());
+
+        // Streams are placed on different nodes if the machine has several of them
+        bool replicated = replicas == InferenceEngine::PluginConfigParams::CPU_WEIGHTS_PER_NODE &&
+                InferenceEngine::getNumaNodesCount() > 1;
+        for (size_t i = 0; i < first.size(); i++) {
+            if (replicated)
+                ASSERT_NE(first[i], second[i]) << replicas;
+            else
+                ASSERT_EQ(first[i], second[i]) << replicas;
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStreamsTests, ExclusiveRequestsUseSingleStream) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"},
+                           {InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS,
+                            InferenceEngine::PluginConfigParams::YES}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> execNetwork;
+    ASSERT_NO_THROW(execNetwork.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), config)));
+    ASSERT_EQ(1, execNetwork->getStreamsNumber());
+}
+
+TEST_F(MKLDNNGraphStreamsTests, ReleaseWeightsFreesIRBuffer) {
+    InferenceEngine::CNNNetReader reference_reader, net_reader;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(reference_reader));
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader, weights));
+
+    MKLDNNPlugin::Config config, release_config;
+    release_config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"},
+                                   {InferenceEngine::PluginConfigParams::KEY_CPU_RELEASE_WEIGHTS,
+                                    InferenceEngine::PluginConfigParams::YES}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> reference, execNetwork;
+    ASSERT_NO_THROW(reference.reset(new MKLDNNTestStreamsExecNetwork(reference_reader.getNetwork(), config)));
+    reference->setNetworkInputs(reference_reader.getNetwork().getInputsInfo());
+    reference->setNetworkOutputs(reference_reader.getNetwork().getOutputsInfo());
+
+    ASSERT_LT(1, weights.use_count());
+    ASSERT_NO_THROW(execNetwork.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), release_config)));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    // Neither the plugin nor the network reference the IR buffer anymore
+    ASSERT_EQ(1, weights.use_count());
+    ASSERT_TRUE(net_reader.getNetwork().getLayerByName("conv")->blobs.empty());
+    ASSERT_NO_THROW(reference_reader.ReleaseWeights());
+    ASSERT_TRUE(reference_reader.getNetwork().getLayerByName("conv")->blobs.empty());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::Blob::Ptr expected, first, second;
+    ASSERT_NO_FATAL_FAILURE(infer(*reference, src, expected));
+    ASSERT_NO_FATAL_FAILURE(infer(*execNetwork, src, first));
+    ASSERT_NO_FATAL_FAILURE(infer(*execNetwork, src, second));
+
+    compare(*expected, *first);
+    compare(*expected, *second);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, ReleaseWeightsFreesIRBufferOfFoldedNetwork) {
+    // The plugin folds the power into the weights of the convolution in a copy of the network
+    model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="2" shift="0.5"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+    InferenceEngine::CNNNetReader reference_reader, net_reader;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(reference_reader));
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader, weights));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_FOLD_CONSTANTS,
+                            InferenceEngine::PluginConfigParams::NO}});
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> reference;
+    ASSERT_NO_THROW(reference.reset(new MKLDNNTestStreamsExecNetwork(reference_reader.getNetwork(), config)));
+    reference->setNetworkInputs(reference_reader.getNetwork().getInputsInfo());
+    reference->setNetworkOutputs(reference_reader.getNetwork().getOutputsInfo());
+
+    std::shared_ptr<MKLDNNPlugin::Engine> engine(new MKLDNNPlugin::Engine());
+    InferenceEngine::IExecutableNetwork::Ptr execNetwork;
+    ASSERT_LT(1, weights.use_count());
+    ASSERT_NO_THROW(engine->LoadNetwork(execNetwork, net_reader.getNetwork(),
+                                        {{InferenceEngine::PluginConfigParams::KEY_CPU_RELEASE_WEIGHTS,
+                                          InferenceEngine::PluginConfigParams::YES}}));
+
+    // Neither the folded copy nor the network of the caller reference the IR buffer anymore
+    ASSERT_EQ(1, weights.use_count());
+    ASSERT_TRUE(net_reader.getNetwork().getLayerByName("conv")->blobs.empty());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::Blob::Ptr expected, dst;
+    ASSERT_NO_FATAL_FAILURE(infer(*reference, src, expected, "power"));
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    ASSERT_EQ(InferenceEngine::OK, execNetwork->CreateInferRequest(inferRequest, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->GetBlob("power", dst, &resp)) << resp.msg;
+
+    compare(*expected, *dst);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, WorkspaceGroupGrowsAndReportsConcurrentUse) {
+    MKLDNNPlugin::MKLDNNWorkspaceGroup group;
+    ASSERT_EQ(0, group.size());
+
+    group.reserve(1000);
+    ASSERT_GE(group.size(), 1000);
+    auto generation = group.generation();
+    group.reserve(500);
+    ASSERT_EQ(generation, group.generation());
+    group.reserve(4000);
+    ASSERT_GE(group.size(), 4000);
+    ASSERT_NE(generation, group.generation());
+
+    int first, second;
+    group.acquire(&first);
+    ASSERT_THROW(group.acquire(&second), InferenceEngine::details::InferenceEngineException);
+    group.release(&second);
+    ASSERT_THROW(group.acquire(&second), InferenceEngine::details::InferenceEngineException);
+
+    // A network loaded while the group is held waits for its release to grow the memory
+    generation = group.generation();
+    std::thread loader([&]() { group.reserve(8000); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(generation, group.generation());
+    group.release(&first);
+    loader.join();
+    ASSERT_GE(group.size(), 8000);
+    ASSERT_NE(generation, group.generation());
+
+    ASSERT_NO_THROW(group.acquire(&second));
+    group.release(&second);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, WorkspaceGroupIsSharedByNetworks) {
+    model = getPooledModel(8);
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    MKLDNNPlugin::Config config, group_config;
+    group_config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_WORKSPACE_GROUP, "cascade"}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> reference, first, second;
+    ASSERT_NO_THROW(reference.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), config)));
+    ASSERT_NO_THROW(first.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), group_config)));
+    auto group = MKLDNNPlugin::MKLDNNWorkspaceGroup::get("cascade", 0, {});
+    size_t groupSize = group->size();
+    ASSERT_LT(0, groupSize);
+    ASSERT_NO_THROW(second.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), group_config)));
+    ASSERT_EQ(groupSize, group->size());
+
+    for (auto &network : {reference, first, second}) {
+        network->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        network->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    }
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::Blob::Ptr expected, dst;
+    ASSERT_NO_FATAL_FAILURE(infer(*reference, src, expected, "pool"));
+    for (auto &network : {first, second, first}) {
+        ASSERT_NO_FATAL_FAILURE(infer(*network, src, dst, "pool"));
+        compare(*expected, *dst);
+    }
+
+    // The group is held by somebody else, so the network can't use it now
+    int owner;
+    group->acquire(&owner);
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    first->CreateInferRequest(inferRequest);
+    InferenceEngine::ResponseDesc resp;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+    ASSERT_NE(InferenceEngine::OK, inferRequest->Infer(&resp));
+    group->release(&owner);
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+}
+
+TEST_F(MKLDNNGraphStreamsTests, WorkspaceGroupGrowsForLargerNetwork) {
+    InferenceEngine::CNNNetReader small_reader, large_reader;
+    model = getPooledModel(8);
+    ASSERT_NO_FATAL_FAILURE(readNetwork(small_reader));
+    model = getPooledModel(32);
+    ASSERT_NO_FATAL_FAILURE(readNetwork(large_reader));
+
+    MKLDNNPlugin::Config config, group_config;
+    group_config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_WORKSPACE_GROUP, "growing"}});
+
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> small_reference, large_reference, small, large;
+    ASSERT_NO_THROW(small_reference.reset(new MKLDNNTestStreamsExecNetwork(small_reader.getNetwork(), config)));
+    ASSERT_NO_THROW(large_reference.reset(new MKLDNNTestStreamsExecNetwork(large_reader.getNetwork(), config)));
+    ASSERT_NO_THROW(small.reset(new MKLDNNTestStreamsExecNetwork(small_reader.getNetwork(), group_config)));
+    for (auto &network : {small_reference, small}) {
+        network->setNetworkInputs(small_reader.getNetwork().getInputsInfo());
+        network->setNetworkOutputs(small_reader.getNetwork().getOutputsInfo());
+    }
+
+    InferenceEngine::Blob::Ptr small_src = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW));
+    small_src->allocate();
+    fill_data(small_src->buffer(), small_src->size());
+
+    InferenceEngine::Blob::Ptr small_expected, dst;
+    ASSERT_NO_FATAL_FAILURE(infer(*small_reference, small_src, small_expected, "pool"));
+    ASSERT_NO_FATAL_FAILURE(infer(*small, small_src, dst, "pool"));
+    compare(*small_expected, *dst);
+
+    // The larger network reallocates the group memory, the first one must move its edges there
+    auto group = MKLDNNPlugin::MKLDNNWorkspaceGroup::get("growing", 0, {});
+    size_t groupSize = group->size();
+    auto generation = group->generation();
+    ASSERT_NO_THROW(large.reset(new MKLDNNTestStreamsExecNetwork(large_reader.getNetwork(), group_config)));
+    for (auto &network : {large_reference, large}) {
+        network->setNetworkInputs(large_reader.getNetwork().getInputsInfo());
+        network->setNetworkOutputs(large_reader.getNetwork().getOutputsInfo());
+    }
+    ASSERT_LT(groupSize, group->size());
+    ASSERT_NE(generation, group->generation());
+
+    InferenceEngine::Blob::Ptr large_src = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 32, 32}, InferenceEngine::NCHW));
+    large_src->allocate();
+    fill_data(large_src->buffer(), large_src->size());
+
+    ASSERT_NO_FATAL_FAILURE(infer(*small, small_src, dst, "pool"));
+    compare(*small_expected, *dst);
+
+    InferenceEngine::Blob::Ptr large_expected;
+    ASSERT_NO_FATAL_FAILURE(infer(*large_reference, large_src, large_expected, "pool"));
+    ASSERT_NO_FATAL_FAILURE(infer(*large, large_src, dst, "pool"));
+    compare(*large_expected, *dst);
+
+    ASSERT_NO_FATAL_FAILURE(infer(*small, small_src, dst, "pool"));
+    compare(*small_expected, *dst);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, MemoryInfoCountsSharedWeightsOnce) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    auto getMemoryInfo = [&](const std::string &streams) {
+        MKLDNNPlugin::Config config;
+        config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_WEIGHTS_REPLICAS,
+                                InferenceEngine::PluginConfigParams::CPU_WEIGHTS_SINGLE}});
+        MKLDNNTestStreamsExecNetwork execNetwork(net_reader.getNetwork(), config);
+        execNetwork.setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork.setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+        InferenceEngine::MemoryInfo info;
+        execNetwork.GetMemoryInfo(info);
+        return info;
+    };
+
+    InferenceEngine::MemoryInfo single, shared;
+    ASSERT_NO_THROW(single = getMemoryInfo("1"));
+    ASSERT_NO_THROW(shared = getMemoryInfo("2"));
+
+    ASSERT_EQ(1, single.graphCopies);
+    ASSERT_EQ(2, shared.graphCopies);
+    ASSERT_GE(single.weights, (432 + 16));
+    ASSERT_EQ(single.weights, shared.weights);
+    ASSERT_EQ(single.workspace, shared.workspace);
+
+    ASSERT_GT(shared.workspace, 0);
+    ASSERT_GE(shared.workspace, shared.workspaceLowerBound);
+    ASSERT_GE(shared.activationsNoReuse, shared.workspace);
+    ASSERT_EQ((1 * 3 * 8 * 8 + 1 * 4 * 8 * 8) * sizeof(float), shared.requestIO);
+    ASSERT_EQ(shared.workspace * 2 + shared.weights + shared.allocatorOverhead, shared.total);
+
+    ASSERT_NE(shared.layers.end(), shared.layers.find("conv"));
+    ASSERT_EQ(single.weights, shared.layers["conv"].weights);
+    ASSERT_GE(shared.layers["conv"].outputs, 1 * 4 * 8 * 8 * sizeof(float));
+}
+
+TEST_F(MKLDNNGraphStreamsTests, WrongNumberOfStreamsThrows) {
+    MKLDNNPlugin::Config config;
+    ASSERT_THROW(config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNGraphStreamsTests, CountersCanBeReadWhileAsyncRequestRuns) {
+    InferenceEngine::CNNNetReader net_reader;
+    model = getPooledModel(256);
+    ASSERT_NO_FATAL_FAILURE(readNetwork(net_reader));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}});
+    std::shared_ptr<MKLDNNTestStreamsExecNetwork> execNetwork;
+    ASSERT_NO_THROW(execNetwork.reset(new MKLDNNTestStreamsExecNetwork(net_reader.getNetwork(), config)));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 256, 256}, InferenceEngine::NCHW));
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::ResponseDesc resp;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+
+    // A read counts as done during inference if the request was started before and is still running after it
+    const size_t inferences = 20;
+    size_t readsWhileBusy = 0;
+    for (size_t i = 0; i < inferences; i++) {
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->StartAsync(&resp)) << resp.msg;
+        InferenceEngine::StatusCode sts;
+        do {
+            std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+            ASSERT_EQ(InferenceEngine::OK, inferRequest->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+            ASSERT_NE(perfMap.end(), perfMap.find("conv"));
+            ASSERT_LE(perfMap["conv"].count, i + 1);
+            sts = inferRequest->Wait(InferenceEngine::IInferRequest::WaitMode::STATUS_ONLY, &resp);
+            if (sts == InferenceEngine::RESULT_NOT_READY)
+                readsWhileBusy++;
+        } while (sts == InferenceEngine::RESULT_NOT_READY);
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                    << resp.msg;
+    }
+    ASSERT_GT(readsWhileBusy, 0);
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+    ASSERT_EQ(inferences, perfMap["conv"].count);
+    ASSERT_EQ(inferences, perfMap["pool"].count);
+}
@@ -1210,7 +1210,10 @@ TEST_F(MKLDNNGraphStructureTests, TestOutputAfterInplacePlusConcat) {
 
     InferenceEngine::CNNNetReader net_reader;
     ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
-    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    // The copies are counted with the performance counters only
+    MKLDNNPlugin::Config config;
+    config.collectPerfCounters = true;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
     InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
     InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
     execNetwork->setNetworkInputs(_networkInputs);
@@ -1243,6 +1246,362 @@ TEST_F(MKLDNNGraphStructureTests, TestOutputAfterInplacePlusConcat) {
     ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
 
     compare(*output, *src);
+
+    // Neither blob can be used as the graph memory: the input goes to the slice and the output comes from
+    // the in-place reshape, so both are copied
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+    for (const std::string name : {std::string("data"), item.first}) {
+        auto it = perfMap.find("<copy: " + name + ">");
+        ASSERT_NE(perfMap.end(), it) << name;
+        ASSERT_STREQ("Copy", it->second.layer_type);
+        ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::EXECUTED, it->second.status);
+        ASSERT_EQ(1, it->second.count);
+        ASSERT_EQ("memcpy: " + std::to_string(src->byteSize()) + " bytes", std::string(it->second.exec_type));
+    }
+}
+
+// Records the edge clusters found by the graph
+class MKLDNNGraphClustersTestClass: public MKLDNNGraphTestClass {
+public:
+    size_t clusters = 0;
+
+protected:
+    std::vector<std::vector<MKLDNNPlugin::MKLDNNEdgePtr>> ClusterEdges() override {
+        auto edgeClusters = MKLDNNGraphTestClass::ClusterEdges();
+        clusters = edgeClusters.size();
+        return edgeClusters;
+    }
+};
+
+// Clusters the edges by scanning the clusters found so far for each edge and merging the clusters
+// which got the same edge, as AllocateWithReuse did before the union-find
+class MKLDNNGraphScanClustersTestClass: public MKLDNNGraphTestClass {
+public:
+    size_t clusters = 0;
+
+protected:
+    std::vector<std::vector<MKLDNNPlugin::MKLDNNEdgePtr>> ClusterEdges() override {
+        std::vector<std::vector<MKLDNNPlugin::MKLDNNEdgePtr>> edge_clasters;
+        for (auto &edge : graphEdges) {
+            MKLDNNPlugin::MKLDNNEdgePtr par = (edge->getStatus() == MKLDNNPlugin::MKLDNNEdge::Status::NotAllocated)
+                                              ? edge->getSharedEdge()
+                                              : nullptr;
+            bool found = false;
+            for (auto &claster : edge_clasters) {
+                for (auto &element : claster) {
+                    if (element == (par ? par : edge)) {
+                        if (par)
+                            claster.push_back(edge);
+                        found = true;
+                        break;
+                    }
+                }
+            }
+            if (!found) {
+                if (par)
+                    edge_clasters.push_back({par, edge});
+                else
+                    edge_clasters.push_back({edge});
+            }
+        }
+
+        for (auto &edge : graphEdges) {
+            std::vector<std::vector<MKLDNNPlugin::MKLDNNEdgePtr> *> to_merge;
+            for (auto &claster : edge_clasters)
+                if (std::find(claster.begin(), claster.end(), edge) != claster.end())
+                    to_merge.push_back(&claster);
+
+            if (to_merge.size() > 1) {
+                auto base_claster = to_merge[0];
+                for (int i = 1; i < to_merge.size(); i++) {
+                    base_claster->insert(base_claster->end(), to_merge[i]->begin(), to_merge[i]->end());
+                    to_merge[i]->clear();
+                }
+                std::sort(base_claster->begin(), base_claster->end());
+                base_claster->erase(std::unique(base_claster->begin(), base_claster->end()), base_claster->end());
+                edge_clasters.erase(std::remove_if(edge_clasters.begin(), edge_clasters.end(),
+                        [](std::vector<MKLDNNPlugin::MKLDNNEdgePtr> &cls) { return cls.empty(); }),
+                        edge_clasters.end());
+            }
+        }
+        clusters = edge_clasters.size();
+        return edge_clasters;
+    }
+};
+
+TEST_F(MKLDNNGraphStructureTests, TestUnionFindClustersInplaceEdgesAsScan) {
+    std::string model = R"V0G0N(
+<?xml version="1.0" ?>
+<net batch="1" name="model" version="2">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="Slice1" precision="FP32" type="Slice">
+			<data axis="1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+				<port id="2">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+				<port id="3">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="2" name="Concat2" precision="FP32" type="Concat">
+			<data axis="1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+				<port id="1">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+				<port id="2">
+					<dim>1</dim>
+					<dim>1</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</input>
+			<output>
+				<port id="3">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="3" name="Reshape3" precision="FP32" type="Reshape">
+			<data axis="0" dim="1,12" num_axes="-1"/>
+			<data axis="1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>2</dim>
+					<dim>2</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>12</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+		<edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+		<edge from-layer="1" from-port="2" to-layer="2" to-port="1"/>
+		<edge from-layer="1" from-port="3" to-layer="2" to-port="2"/>
+		<edge from-layer="2" from-port="3" to-layer="3" to-port="0"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    // Slice outputs are views of the input and concat inputs are views of its output,
+    // so views of views have to end up in one cluster
+    MKLDNNGraphClustersTestClass graph;
+    MKLDNNGraphScanClustersTestClass reference;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_NO_THROW(reference.CreateGraph(net_reader.getNetwork()));
+    ASSERT_GT(graph.clusters, 0);
+    ASSERT_EQ(reference.clusters, graph.clusters);
+
+    InferenceEngine::MemoryInfo info, referenceInfo;
+    std::unordered_set<const MKLDNNPlugin::MKLDNNMemory *> counted, referenceCounted;
+    graph.GetMemoryInfo(info, counted);
+    reference.GetMemoryInfo(referenceInfo, referenceCounted);
+    ASSERT_EQ(referenceInfo.workspace, info.workspace);
+    ASSERT_EQ(referenceInfo.workspaceLowerBound, info.workspaceLowerBound);
+    ASSERT_EQ(referenceInfo.activationsNoReuse, info.activationsNoReuse);
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+    InferenceEngine::ResponseDesc resp;
+
+    // Slices are concatenated back in the same order, so the in-place edges must give the input data
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 2, 2}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob(item.first.c_str(), output, &resp)) << resp.msg;
+
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+    compare(*output, *src);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestLoadStagesAreReportedWithPerfCounters) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>224</dim>
+                    <dim>224</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="2" stride-y="2" pad-x="3" pad-y="3" kernel-x="7" kernel-y="7" output="64" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>224</dim>
+                    <dim>224</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </output>
+            <weights offset="0" size="37632"/>
+            <biases offset="37632" size="256"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool" type="Pooling" precision="FP32" id="3">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {37888});
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    const char *stages[] = {"<load: parse>", "<load: optimize>", "<load: select descriptors>",
+                            "<load: allocate>", "<load: create primitives>"};
+    for (bool perfCount : {true, false}) {
+        MKLDNNPlugin::Config config;
+        config.collectPerfCounters = perfCount;
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
+        execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork->CreateInferRequest(inferRequest);
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+
+        if (!perfCount) {
+            // Default counters have to sum up to the inference time
+            for (const auto &stage : stages)
+                ASSERT_EQ(perfMap.end(), perfMap.find(stage)) << stage;
+            continue;
+        }
+        for (const auto &stage : stages) {
+            auto it = perfMap.find(stage);
+            ASSERT_NE(perfMap.end(), it) << stage;
+            ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::NOT_RUN, it->second.status) << stage;
+            ASSERT_STREQ("LoadNetwork", it->second.layer_type) << stage;
+            ASSERT_EQ(1, it->second.count) << stage;
+            ASSERT_GT(it->second.realTime_uSec, 0) << stage;
+            ASSERT_EQ(0, it->second.cpu_uSec) << stage;
+        }
+    }
 }
 
 TEST_F(MKLDNNGraphStructureTests, TestResnetPart) {
@@ -4919,6 +5278,26 @@ TEST_F(MKLDNNGraphStructureTests, TestConstantLayerAsOutput) {
     InferenceEngine::TBlob<float>::Ptr dstOut = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc(), refDst.data());
 
     compare(*output, *dstOut);
+
+    // The prior boxes depend on the shapes of the inputs only, so they are computed once on load and
+    // the node reads its feature map input as it is, without a reorder
+    bool found = false;
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != "x32_priorbox")
+            continue;
+        found = true;
+        ASSERT_TRUE(node->isShapeOnly());
+        ASSERT_TRUE(node->isConstant());
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            ASSERT_NE(MKLDNNPlugin::Reorder, node->getParentEdgeAt(i)->getParent()->getType());
+    }
+    ASSERT_TRUE(found);
+
+    for (size_t i = 0; i < src->size(); i++) {
+        data[i] = -data[i];
+    }
+    graph.Infer(srcs, outputBlobs);
+    compare(*output, *dstOut);
 }
 
 TEST_F(MKLDNNGraphStructureTests, TestGemmConvolutionWithConcat) {
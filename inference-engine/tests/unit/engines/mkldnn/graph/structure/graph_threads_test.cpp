@@ -0,0 +1,247 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include "../test_graph.hpp"
+#include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
+#include <thread>
+
+// The tests inspect the OpenMP thread team, so they are built with the OpenMP threading backend only
+#if IE_THREAD == IE_THREAD_OMP && !(defined(__APPLE__) || defined(_WIN32))
+#include <sched.h>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNGraphThreadsTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    struct TeamInfo {
+        int threads = 0;
+        std::vector<cpu_set_t> affinity;
+    };
+
+    // Thread team of the calling thread
+    static TeamInfo currentTeam() {
+        TeamInfo team;
+        team.threads = omp_get_max_threads();
+        team.affinity.resize(team.threads);
+        #pragma omp parallel num_threads(team.threads)
+        {
+            sched_getaffinity(0, sizeof(cpu_set_t), &team.affinity[omp_get_thread_num()]);
+        }
+        return team;
+    }
+
+    // Creates the graph in a separate thread and inspects the thread team of that thread
+    void createGraphInThread(const std::map<std::string, std::string> &properties, TeamInfo &team) {
+        InferenceEngine::CNNNetReader net_reader;
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        MKLDNNPlugin::Config config;
+        config.readProperties(properties);
+
+        std::exception_ptr error;
+        std::thread worker([&]() {
+            try {
+                MKLDNNGraphTestClass graph;
+                graph.setConfig(config);
+                graph.CreateGraph(net_reader.getNetwork());
+                team = currentTeam();
+            } catch (...) {
+                error = std::current_exception();
+            }
+        });
+        worker.join();
+        if (error)
+            std::rethrow_exception(error);
+    }
+};
+
+TEST_F(MKLDNNGraphThreadsTests, AffinityIsAppliedToWorkerThreads) {
+    TeamInfo team;
+    ASSERT_NO_THROW(createGraphInThread({{InferenceEngine::PluginConfigParams::KEY_CPU_AFFINITY, "0"},
+                                         {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "2"}}, team));
+
+    ASSERT_EQ(2, team.threads);
+    for (auto &cpus : team.affinity) {
+        ASSERT_EQ(1, CPU_COUNT(&cpus));
+        ASSERT_TRUE(CPU_ISSET(0, &cpus));
+    }
+}
+
+TEST_F(MKLDNNGraphThreadsTests, NetworksHaveIndependentThreadSettings) {
+    cpu_set_t processCpus;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(processCpus), &processCpus));
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    auto createGraph = [&](MKLDNNGraphTestClass &graph, const std::map<std::string, std::string> &properties) {
+        MKLDNNPlugin::Config config;
+        config.readProperties(properties);
+        graph.setConfig(config);
+        graph.CreateGraph(net_reader.getNetwork());
+    };
+
+    // Both networks are created and executed by one thread, like networks sharing an executor
+    std::exception_ptr error;
+    std::vector<TeamInfo> teams;
+    std::thread worker([&]() {
+        try {
+            MKLDNNGraphTestClass pinned, free;
+            createGraph(pinned, {{InferenceEngine::PluginConfigParams::KEY_CPU_AFFINITY, "0"}});
+            createGraph(free, {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD,
+                                InferenceEngine::PluginConfigParams::NO},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "3"}});
+
+            InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+            InferenceEngine::BlobMap srcs = {{"data", src}};
+
+            auto infer = [&](MKLDNNGraphTestClass &graph) {
+                InferenceEngine::Blob::Ptr dst = InferenceEngine::make_shared_blob<float>(desc);
+                dst->allocate();
+                InferenceEngine::BlobMap outputs = {{"relu", dst}};
+                graph.Infer(srcs, outputs);
+                teams.push_back(currentTeam());
+            };
+
+            infer(pinned);
+            infer(free);
+            infer(pinned);
+            infer(free);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    });
+    worker.join();
+    if (error)
+        std::rethrow_exception(error);
+
+    ASSERT_EQ(4, teams.size());
+    for (size_t i = 0; i < teams.size(); i += 2) {
+        TeamInfo &pinned = teams[i];
+        ASSERT_EQ(1, pinned.threads) << i;
+        ASSERT_TRUE(CPU_ISSET(0, &pinned.affinity[0])) << i;
+        ASSERT_EQ(1, CPU_COUNT(&pinned.affinity[0])) << i;
+
+        // Settings of the first network don't leak to the team running the second one
+        TeamInfo &free = teams[i + 1];
+        ASSERT_EQ(3, free.threads) << i;
+        for (auto &cpus : free.affinity)
+            ASSERT_TRUE(CPU_EQUAL(&cpus, &processCpus)) << i;
+    }
+}
+
+TEST_F(MKLDNNGraphThreadsTests, GraphsWithSameSettingsDontReconfigureThreads) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    auto createGraph = [&](MKLDNNGraphTestClass &graph, const std::string &threads) {
+        MKLDNNPlugin::Config config;
+        config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD,
+                                InferenceEngine::PluginConfigParams::NO},
+                               {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, threads}});
+        graph.setConfig(config);
+        graph.CreateGraph(net_reader.getNetwork());
+    };
+
+    std::exception_ptr error;
+    std::vector<int> threads;
+    std::thread worker([&]() {
+        try {
+            MKLDNNGraphTestClass first, second, other;
+            createGraph(first, "2");
+            createGraph(second, "2");
+            createGraph(other, "3");
+
+            InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+            InferenceEngine::BlobMap srcs = {{"data", src}};
+
+            auto infer = [&](MKLDNNGraphTestClass &graph) {
+                InferenceEngine::Blob::Ptr dst = InferenceEngine::make_shared_blob<float>(desc);
+                dst->allocate();
+                InferenceEngine::BlobMap outputs = {{"relu", dst}};
+                graph.Infer(srcs, outputs);
+                threads.push_back(omp_get_max_threads());
+            };
+
+            infer(first);
+            // A team which isn't reconfigured keeps this value
+            omp_set_num_threads(5);
+            infer(second);
+            infer(first);
+            infer(second);
+            infer(other);
+            infer(first);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    });
+    worker.join();
+    if (error)
+        std::rethrow_exception(error);
+
+    ASSERT_EQ(std::vector<int>({2, 5, 5, 5, 3, 2}), threads);
+}
+
+TEST_F(MKLDNNGraphThreadsTests, WrongAffinityThrows) {
+    MKLDNNPlugin::Config config;
+    ASSERT_THROW(config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_AFFINITY, "3-1"}}),
+                 InferenceEngine::details::InferenceEngineException);
+    ASSERT_THROW(config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "-1"}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+#endif  // IE_THREAD == IE_THREAD_OMP && !(defined(__APPLE__) || defined(_WIN32))
@@ -0,0 +1,84 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "mkldnn_plugin/perf_count.h"
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+class MKLDNNPerfCountTests: public ::testing::Test {
+protected:
+    void measure(PerfCount &counter, int durationUs, PerfCount *extra = nullptr) {
+        PerfHelper perf(counter, extra, true);
+        if (durationUs > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(durationUs));
+    }
+};
+
+TEST_F(MKLDNNPerfCountTests, emptyCounterIsNotRun) {
+    PerfCount counter;
+    InferenceEngine::InferenceEngineProfileInfo info;
+    counter.fill(info);
+
+    ASSERT_EQ(0, counter.statistics().count);
+    ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::NOT_RUN, info.status);
+    ASSERT_EQ(0, info.p99_uSec);
+}
+
+TEST_F(MKLDNNPerfCountTests, percentilesSeparateTail) {
+    PerfCount counter;
+    for (int i = 0; i < 95; i++)
+        measure(counter, 0);
+    for (int i = 0; i < 5; i++)
+        measure(counter, 20000);
+
+    auto stats = counter.statistics();
+    ASSERT_EQ(100, stats.count);
+    ASSERT_LE(stats.min, stats.p50);
+    ASSERT_LE(stats.p50, stats.p90);
+    ASSERT_LE(stats.p90, stats.p99);
+    ASSERT_LE(stats.p99, stats.max);
+    // Percentiles are precise up to the histogram bucket, i.e. within 25%
+    ASSERT_LT(stats.p90, 15000);
+    ASSERT_GE(stats.p99, 15000);
+    ASSERT_GE(stats.max, 20000);
+    // Sleeping threads don't consume CPU time
+    ASSERT_LT(stats.cpuAvg, stats.avg);
+}
+
+TEST_F(MKLDNNPerfCountTests, extraCounterGetsTheSameSamples) {
+    PerfCount counter, extra;
+    measure(counter, 1000, &extra);
+    measure(counter, 0);
+
+    ASSERT_EQ(2, counter.statistics().count);
+    ASSERT_EQ(1, extra.statistics().count);
+    ASSERT_EQ(extra.statistics().max, counter.statistics().max);
+}
+
+TEST_F(MKLDNNPerfCountTests, resetClearsStatistics) {
+    PerfCount counter;
+    measure(counter, 1000);
+    counter.reset();
+    measure(counter, 0);
+
+    auto stats = counter.statistics();
+    ASSERT_EQ(1, stats.count);
+    ASSERT_LT(stats.max, 1000);
+}
+
+TEST_F(MKLDNNPerfCountTests, disabledHelperAddsNoSamples) {
+    PerfCount counter, extra;
+    {
+        PerfHelper perf(counter, &extra, true, false);
+    }
+    measure(counter, 0);
+
+    ASSERT_EQ(1, counter.statistics().count);
+    ASSERT_EQ(0, extra.statistics().count);
+}
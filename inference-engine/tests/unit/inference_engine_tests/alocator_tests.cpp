@@ -7,6 +7,7 @@
 #include <gmock/gmock-spec-builders.h>
 
 #include "ie_allocator.hpp"
+#include "ie_memory_policy.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -36,3 +37,60 @@ TEST_F(SystemAllocatorTests, canLockAllocatedMemory) {
     ptr [9999] = 11;
     ASSERT_EQ(ptr[9999], 11);
 }
+
+TEST_F(SystemAllocatorTests, allocatedMemoryIsCacheLineAligned) {
+    for (size_t size : {1, 3, 100, 10000}) {
+        void * handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(allocator->lock(handle)) % 64);
+        allocator->free(handle);
+    }
+}
+
+TEST(MemoryPolicyTests, canAllocateWithCustomAlignment) {
+    MemoryPolicy policy;
+    policy.alignment = 4096;
+    void * ptr = alignedAlloc(100, policy);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % 4096);
+    alignedFree(ptr);
+}
+
+TEST(MemoryPolicyTests, canAllocateLargeBlockWithHugePagesAndNumaPlacement) {
+    const size_t size = 8 * 1024 * 1024;
+    for (auto hugePages : {HugePagesMode::None, HugePagesMode::Transparent, HugePagesMode::Explicit}) {
+        MemoryPolicy policy;
+        policy.hugePages = hugePages;
+        policy.numaNode = MemoryPolicy::NUMA_LOCAL;
+        auto * ptr = static_cast<char *>(alignedAlloc(size, policy));
+        ASSERT_NE(nullptr, ptr);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % 64);
+        ptr[0] = 1;
+        ptr[size - 1] = 2;
+        ASSERT_EQ(2, ptr[size - 1]);
+        alignedFree(ptr);
+    }
+}
+
+TEST(MemoryPolicyTests, numaNodeOfCurrentThreadIsValid) {
+    int node = getCurrentNumaNode();
+    ASSERT_GE(node, 0);
+    ASSERT_LT(node, getNumaNodesCount());
+}
+
+TEST(MemoryPolicyTests, reservedSizeCoversAlignmentAndPages) {
+    ASSERT_EQ(0, alignedReservedSize(nullptr));
+
+    MemoryPolicy policy;
+    policy.alignment = 4096;
+    void * ptr = alignedAlloc(100, policy);
+    ASSERT_GE(alignedReservedSize(ptr), 100 + 4096);
+    alignedFree(ptr);
+
+    policy.hugePages = HugePagesMode::Transparent;
+    const size_t size = 8 * 1024 * 1024 + 1;
+    ptr = alignedAlloc(size, policy);
+    ASSERT_GE(alignedReservedSize(ptr), size);
+    ASSERT_EQ(0, alignedReservedSize(ptr) % 4096);
+    alignedFree(ptr);
+}
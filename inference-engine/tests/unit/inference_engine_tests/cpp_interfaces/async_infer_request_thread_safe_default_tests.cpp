@@ -93,6 +93,36 @@ TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfInitNextTaskFails
     ASSERT_NO_THROW(mockAsync.StartAsync());
 }
 
+// SetConfig
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetConfig) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetConfig({}); }, REQUEST_BUSY_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, setConfigPassesSchedulingPropertiesToTask) {
+    Task::Ptr startedTask;
+    EXPECT_CALL(*mockTaskExecutor.get(), startTask(_)).WillOnce(DoAll(SaveArg<0>(&startedTask), Return(true)));
+
+    testRequest->SetConfig({{PluginConfigParams::KEY_REQUEST_PRIORITY, PluginConfigParams::REQUEST_PRIORITY_HIGH},
+                            {PluginConfigParams::KEY_REQUEST_DEADLINE, "1000000"}});
+    auto start = std::chrono::steady_clock::now();
+    testRequest->StartAsync();
+
+    ASSERT_NE(nullptr, startedTask);
+    ASSERT_EQ(1, startedTask->getPriority());
+    ASSERT_GE(startedTask->getDeadline(), start + std::chrono::seconds(1));
+    ASSERT_LE(startedTask->getDeadline(), std::chrono::steady_clock::now() + std::chrono::seconds(1));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, setConfigThrowsOnWrongValues) {
+    ASSERT_THROW(testRequest->SetConfig({{PluginConfigParams::KEY_REQUEST_PRIORITY, "URGENT"}}),
+                 InferenceEngineException);
+    ASSERT_THROW(testRequest->SetConfig({{PluginConfigParams::KEY_REQUEST_DEADLINE, "-1"}}),
+                 InferenceEngineException);
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetConfig({{"UNKNOWN_KEY", "1"}}); },
+                                               NOT_FOUND_str));
+}
+
 // GetUserData
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetUserData) {
     testRequest->setRequestBusy();
@@ -130,12 +160,11 @@ TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfInferFails) {
 }
 
 // GetPerformanceCounts
-TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetPerformanceCounts) {
+TEST_F(InferRequestThreadSafeDefaultTests, canGetPerformanceCountsOfBusyRequest) {
     testRequest->setRequestBusy();
-    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
-        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
-        testRequest->GetPerformanceCounts(info);
-    }, REQUEST_BUSY_str));
+    EXPECT_CALL(*mockInferRequestInternal.get(), GetPerformanceCounts(_)).Times(1);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
+    ASSERT_NO_THROW(testRequest->GetPerformanceCounts(info));
 }
 
 // GetBlob
@@ -217,3 +246,31 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledInlineWithoutCallbackExecutor) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      nullptr, nullptr);
+    testRequest->SetSpinWait(1000);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    std::thread::id inferThread, callbackThread;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                callbackThread = std::this_thread::get_id();
+                ASSERT_EQ(StatusCode::OK, status);
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Invoke([&]() {
+        inferThread = std::this_thread::get_id();
+    }));
+
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(inferThread, callbackThread);
+    ASSERT_NE(std::this_thread::get_id(), callbackThread);
+}
@@ -95,12 +95,11 @@ TEST_F(AsyncInferRequestThreadSafeInternalTests, canResetBusyStatusIfInferFails)
 }
 
 // GetPerformanceCounts
-TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnGetPerformanceCounts) {
+TEST_F(AsyncInferRequestThreadSafeInternalTests, canGetPerformanceCountsOfBusyRequest) {
     testRequest->setRequestBusy();
-    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
-        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
-        testRequest->GetPerformanceCounts(info);
-    }, REQUEST_BUSY_str));
+    EXPECT_CALL(*testRequest.get(), GetPerformanceCounts_ThreadUnsafe(_)).Times(1);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
+    ASSERT_NO_THROW(testRequest->GetPerformanceCounts(info));
 }
 
 // GetBlob
@@ -89,3 +89,17 @@ TEST_F(ExecutableNetworkBaseTests, canCatchUnknownErrorInGetMappedTopology) {
     std::map<std::string, std::vector<PrimitiveInfo::Ptr>> deployedTopology;
     ASSERT_EQ(UNEXPECTED, exeNetwork->GetMappedTopology(deployedTopology, nullptr));
 }
+
+// GetMemoryInfo
+TEST_F(ExecutableNetworkBaseTests, canForwardGetMemoryInfo) {
+    MemoryInfo info;
+    EXPECT_CALL(*mock_impl.get(), GetMemoryInfo(Ref(info))).Times(1);
+    ASSERT_EQ(OK, exeNetwork->GetMemoryInfo(info, &dsc));
+}
+
+TEST_F(ExecutableNetworkBaseTests, canReportErrorInGetMemoryInfo) {
+    EXPECT_CALL(*mock_impl.get(), GetMemoryInfo(_)).WillOnce(Throw(std::runtime_error("compare")));
+    MemoryInfo info;
+    ASSERT_NE(exeNetwork->GetMemoryInfo(info, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
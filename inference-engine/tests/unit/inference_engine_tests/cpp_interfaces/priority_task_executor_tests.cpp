@@ -0,0 +1,163 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <cpp_interfaces/ie_priority_task_executor.hpp>
+#include <cpp_interfaces/ie_executor_manager.hpp>
+#include <ie_common.h>
+#include "task_tests_utils.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class PriorityTaskExecutorTests : public ::testing::Test {
+protected:
+    std::atomic_bool released{false};
+    std::mutex orderMutex;
+    std::vector<int> order;
+
+    // Occupies a worker until release() is called, so the following tasks are queued
+    Task::Ptr gate() {
+        return std::make_shared<Task>([this]() {
+            while (!released) std::this_thread::yield();
+        });
+    }
+
+    void release() {
+        released = true;
+    }
+
+    Task::Ptr recorder(int id, int priority = 0,
+                       std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) {
+        auto task = std::make_shared<Task>([this, id]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(id);
+        });
+        task->setPriority(priority);
+        task->setDeadline(deadline);
+        return task;
+    }
+};
+
+TEST_F(PriorityTaskExecutorTests, throwsIfNoWorkers) {
+    EXPECT_THROW(PriorityTaskExecutor("test", 0), InferenceEngineException);
+}
+
+TEST_F(PriorityTaskExecutorTests, runsTasksInFIFOOrderByDefault) {
+    std::vector<Task::Ptr> tasks;
+    {
+        PriorityTaskExecutor executor;
+        auto first = gate();
+        executor.startTask(first);
+        for (int i = 0; i < 5; i++) {
+            tasks.push_back(recorder(i));
+            executor.startTask(tasks.back());
+        }
+        release();
+    }
+    ASSERT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST_F(PriorityTaskExecutorTests, runsHigherPriorityFirst) {
+    {
+        PriorityTaskExecutor executor("test", 1, 0);
+        executor.startTask(gate());
+        executor.startTask(recorder(0, -1));
+        executor.startTask(recorder(1, 0));
+        executor.startTask(recorder(2, 1));
+        executor.startTask(recorder(3, 0));
+        release();
+    }
+    ASSERT_EQ(order, std::vector<int>({2, 1, 3, 0}));
+}
+
+TEST_F(PriorityTaskExecutorTests, runsEarlierDeadlineFirstWithinPriority) {
+    auto now = std::chrono::steady_clock::now();
+    {
+        PriorityTaskExecutor executor("test", 1, 0);
+        executor.startTask(gate());
+        executor.startTask(recorder(0, 0));
+        executor.startTask(recorder(1, 0, now + std::chrono::seconds(20)));
+        executor.startTask(recorder(2, 0, now + std::chrono::seconds(10)));
+        executor.startTask(recorder(3, 1, now + std::chrono::seconds(30)));
+        release();
+    }
+    ASSERT_EQ(order, std::vector<int>({3, 2, 1, 0}));
+}
+
+TEST_F(PriorityTaskExecutorTests, agingPromotesWaitingTasks) {
+    {
+        PriorityTaskExecutor executor("test", 1, 1000);
+        executor.startTask(gate());
+        executor.startTask(recorder(0, -1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        executor.startTask(recorder(1, 1));
+        release();
+    }
+    ASSERT_EQ(order, std::vector<int>({0, 1}));
+}
+
+TEST_F(PriorityTaskExecutorTests, workersRunTasksConcurrently) {
+    std::atomic<int> started(0);
+    auto rendezvous = [&]() {
+        started++;
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started < 2 && std::chrono::steady_clock::now() < timeout) std::this_thread::yield();
+    };
+    auto first = std::make_shared<Task>(rendezvous);
+    auto second = std::make_shared<Task>(rendezvous);
+
+    PriorityTaskExecutor executor("test", 2);
+    executor.startTask(first);
+    executor.startTask(second);
+    ASSERT_EQ(first->wait(-1), Task::TS_DONE);
+    ASSERT_EQ(second->wait(-1), Task::TS_DONE);
+    ASSERT_EQ(started, 2);
+}
+
+TEST_F(PriorityTaskExecutorTests, reportsStatistics) {
+    PriorityTaskExecutor executor("test", 1);
+    auto first = gate();
+    executor.startTask(first);
+    auto late = recorder(0, 0, std::chrono::steady_clock::now());
+    auto other = recorder(1);
+    executor.startTask(late);
+    executor.startTask(other);
+
+    auto statistics = executor.getStatistics();
+    ASSERT_EQ(statistics.queueDepth + statistics.tasksStarted, 3);
+    ASSERT_GE(statistics.maxQueueDepth, 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    release();
+    late->wait(-1);
+    other->wait(-1);
+
+    statistics = executor.getStatistics();
+    ASSERT_EQ(statistics.queueDepth, 0);
+    ASSERT_EQ(statistics.tasksStarted, 3);
+    ASSERT_GE(statistics.maxWaitTime, 2000);
+    ASSERT_GE(statistics.totalWaitTime, statistics.maxWaitTime);
+    ASSERT_EQ(statistics.deadlinesMissed, 1);
+}
+
+TEST_F(PriorityTaskExecutorTests, executorManagerReportsStatistics) {
+    ExecutorManagerImpl manager;
+    auto executor = manager.getExecutor("test");
+    auto task = std::make_shared<Task>();
+    executor->startTask(task);
+    task->wait(-1);
+
+    auto statistics = manager.getStatistics();
+    ASSERT_EQ(statistics.size(), 1);
+    ASSERT_EQ(statistics["test"].tasksStarted, 1);
+}
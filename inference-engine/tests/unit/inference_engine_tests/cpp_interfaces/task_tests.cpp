@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include <thread>
+#include <atomic>
+#include <chrono>
 
 #include <ie_common.h>
 #include <details/ie_exception.hpp>
@@ -80,3 +82,38 @@ TEST_F(TaskTests, canSyncNThreadsUsingTaskSync) {
     for (auto &status : statuses) ASSERT_NE(Task::Status::TS_BUSY, status);
     ASSERT_EQ(sharedVar, THREAD_NUMBER * NUM_INTERNAL_ITERATIONS);
 }
+
+TEST_F(TaskTests, canRunWithoutTaskSync) {
+    TaskSynchronizer::Ptr taskSynchronizer;
+    ASSERT_EQ(_task->runWithSynchronizer(taskSynchronizer), Task::TS_DONE);
+}
+
+TEST_F(TaskTests, spinWaitReturnsWhenTaskIsDone) {
+    std::atomic_bool started(false);
+    Task::Ptr task = std::make_shared<Task>([&]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    });
+    task->occupy();
+    MetaThread metaThread([&]() { task->runNoThrowNoBusyCheck(); });
+    while (!started) std::this_thread::yield();
+
+    // The spin budget is shorter than the task, so the rest of the time is spent in blocking wait
+    ASSERT_EQ(task->spinWait(-1, 100), Task::TS_DONE);
+    ASSERT_FALSE(task->isOnWait());
+    metaThread.join();
+}
+
+TEST_F(TaskTests, spinWaitRespectsTimeout) {
+    std::atomic_bool finish(false);
+    Task::Ptr task = std::make_shared<Task>([&]() {
+        while (!finish) std::this_thread::yield();
+    });
+    task->occupy();
+    MetaThread metaThread([&]() { task->runNoThrowNoBusyCheck(); });
+
+    ASSERT_EQ(task->spinWait(1, 10000000), Task::TS_BUSY);
+    finish = true;
+    metaThread.join();
+    ASSERT_EQ(task->spinWait(0, 1000), Task::TS_DONE);
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "ie_parallel.hpp"
+
+using namespace std;
+using namespace InferenceEngine;
+
+class ParallelTests: public ::testing::Test {
+};
+
+TEST_F(ParallelTests, splitterCoversRangeWithoutOverlaps) {
+    const size_t n = 17;
+    for (int team = 1; team <= 8; team++) {
+        size_t expected_start = 0;
+        for (int tid = 0; tid < team; tid++) {
+            size_t start = 0, end = 0;
+            splitter(n, team, tid, start, end);
+            ASSERT_EQ(expected_start, start);
+            ASSERT_LE(start, end);
+            expected_start = end;
+        }
+        ASSERT_EQ(n, expected_start);
+    }
+}
+
+TEST_F(ParallelTests, parallelForVisitsEachItemOnce) {
+    const int D0 = 3, D1 = 5, D2 = 7;
+    vector<atomic<int>> visits(D0 * D1 * D2);
+    for (auto &v : visits) v = 0;
+
+    parallel_for(D0 * D1 * D2, [&](int i) { visits[i]++; });
+    parallel_for2d(D0, D1 * D2, [&](int d0, int d1) { visits[d0 * D1 * D2 + d1]++; });
+    parallel_for3d(D0, D1, D2, [&](int d0, int d1, int d2) { visits[(d0 * D1 + d1) * D2 + d2]++; });
+
+    for (auto &v : visits)
+        ASSERT_EQ(3, v.load());
+}
+
+TEST_F(ParallelTests, parallelForHandlesEmptyRange) {
+    int calls = 0;
+    parallel_for(0, [&](int) { calls++; });
+    parallel_for2d(0, 4, [&](int, int) { calls++; });
+    parallel_for3d(4, 0, 4, [&](int, int, int) { calls++; });
+    ASSERT_EQ(0, calls);
+}
+
+TEST_F(ParallelTests, parallelSumIsDeterministic) {
+    const int D0 = 100003;
+    auto item = [](int i) { return 1.0f / (1 + i % 97); };
+
+    float first = parallel_sum(D0, 0.0f, item);
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(first, parallel_sum(D0, 0.0f, item));
+
+    double reference = 0;
+    for (int i = 0; i < D0; i++) reference += item(i);
+    ASSERT_NEAR(reference, first, reference * 1e-3);
+}
+
+TEST_F(ParallelTests, parallelSum2dAddsInput) {
+    int sum = parallel_sum2d(4, 6, 10, [](int d0, int d1) { return d0 * 6 + d1; });
+    ASSERT_EQ(10 + 23 * 24 / 2, sum);
+}
+
+TEST_F(ParallelTests, nestedParallelForIsComplete) {
+    const int D0 = 8, D1 = 64;
+    vector<atomic<int>> visits(D0 * D1);
+    for (auto &v : visits) v = 0;
+
+    parallel_for(D0, [&](int d0) {
+        parallel_for(D1, [&](int d1) { visits[d0 * D1 + d1]++; });
+    });
+
+    for (auto &v : visits)
+        ASSERT_EQ(1, v.load());
+}
+
+TEST_F(ParallelTests, parallelNtReportsTeam) {
+    vector<int> ids(parallel_get_max_threads(), -1);
+    parallel_nt(0, [&](int ithr, int nthr) {
+        ASSERT_LE(nthr, static_cast<int>(ids.size()));
+        ids[ithr] = ithr;
+    });
+    ASSERT_EQ(0, ids[0]);
+}
+
+#if IE_THREAD == IE_THREAD_POOL
+TEST_F(ParallelTests, exceptionIsRethrownInCaller) {
+    ASSERT_THROW(parallel_for(1000, [](int i) {
+        if (i == 999) throw std::runtime_error("failed");
+    }), std::runtime_error);
+}
+#endif
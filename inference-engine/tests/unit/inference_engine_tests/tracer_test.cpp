@@ -0,0 +1,102 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "ie_tracer.hpp"
+
+using namespace std;
+using namespace InferenceEngine;
+
+class TracerTests: public ::testing::Test {
+protected:
+    void SetUp() override {
+        wasEnabled = Tracing::IsEnabled();
+        Tracing::Clear();
+    }
+
+    void TearDown() override {
+        Tracing::Enable(wasEnabled);
+        Tracing::Clear();
+    }
+
+    static string dump() {
+        stringstream out;
+        Tracing::Dump(out);
+        return out.str();
+    }
+
+    static size_t count(const string &str, const string &what) {
+        size_t n = 0;
+        for (auto pos = str.find(what); pos != string::npos; pos = str.find(what, pos + 1)) n++;
+        return n;
+    }
+
+    bool wasEnabled = false;
+};
+
+TEST_F(TracerTests, nothingIsRecordedWhenDisabled) {
+    Tracing::Enable(false);
+    {
+        IE_TRACE_SCOPE("disabledScope", "test")
+    }
+    ASSERT_EQ(string::npos, dump().find("disabledScope"));
+}
+
+TEST_F(TracerTests, scopeIsDumpedAsCompleteEvent) {
+    Tracing::Enable(true);
+    {
+        Tracing::TraceScope scope("layer \"1\"", "test", "jit_avx2");
+    }
+    auto trace = dump();
+    ASSERT_EQ(0, trace.find("{\"traceEvents\":["));
+    ASSERT_NE(string::npos, trace.find("\"name\":\"layer \\\"1\\\"\",\"cat\":\"test\",\"ph\":\"X\""));
+    ASSERT_NE(string::npos, trace.find("\"args\":{\"detail\":\"jit_avx2\"}"));
+}
+
+TEST_F(TracerTests, asyncEventHasBeginAndEnd) {
+    Tracing::Enable(true);
+    auto start = Tracing::Now();
+    Tracing::RecordAsync("queue", "queue", nullptr, start, start + 5000);
+    auto trace = dump();
+    ASSERT_EQ(1, count(trace, "\"ph\":\"b\""));
+    ASSERT_EQ(1, count(trace, "\"ph\":\"e\""));
+}
+
+TEST_F(TracerTests, eventsOfAllThreadsAreDumped) {
+    Tracing::Enable(true);
+    auto work = [](int n) {
+        for (int i = 0; i < n; i++) {
+            IE_TRACE_SCOPE("threadScope", "test")
+        }
+    };
+    thread t1(work, 10), t2(work, 20);
+    t1.join();
+    t2.join();
+    ASSERT_EQ(30, count(dump(), "threadScope"));
+}
+
+TEST_F(TracerTests, ringBufferKeepsLastEvents) {
+    Tracing::Enable(true);
+    thread([] {
+        for (int i = 0; i < 100000; i++) {
+            IE_TRACE_SCOPE("ringScope", "test")
+        }
+    }).join();
+    auto n = count(dump(), "ringScope");
+    ASSERT_GT(n, 0);
+    ASSERT_LT(n, 100000);
+}
+
+TEST_F(TracerTests, clearDropsEvents) {
+    Tracing::Enable(true);
+    {
+        IE_TRACE_SCOPE("clearedScope", "test")
+    }
+    Tracing::Clear();
+    ASSERT_EQ(string::npos, dump().find("clearedScope"));
+}
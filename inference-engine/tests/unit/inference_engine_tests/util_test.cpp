@@ -16,6 +16,7 @@
 #include <tests_common.hpp>
 #include <graph_transformer.h>
 #include "ie_utils.hpp"
+#include "ie_blob_proxy.hpp"
 
 namespace IE = InferenceEngine;
 
@@ -1710,3 +1711,132 @@ TEST(UtilTests, replaceLayerWithNewLayer) {
                     layer3Check->insData[1].lock() == data.find("data3")->second);
     }
 }
+
+TEST(UtilTests, detachLayerBlobsCopiesProxies) {
+    auto buffer = IE::make_shared_blob<uint8_t>(IE::Precision::U8, IE::C, {32});
+    buffer->allocate();
+    for (size_t i = 0; i < buffer->size(); i++)
+        buffer->buffer().as<uint8_t *>()[i] = static_cast<uint8_t>(i);
+
+    IE::ConvolutionLayer layer(IE::LayerParams{"conv", "Convolution", IE::Precision::FP32});
+    layer._weights = std::make_shared<IE::TBlobProxy<float>>(IE::Precision::FP32, IE::C, buffer, 0, IE::SizeVector{6});
+    layer._biases = std::make_shared<IE::TBlobProxy<float>>(IE::Precision::FP32, IE::C, buffer, 24, IE::SizeVector{2});
+    layer.blobs["weights"] = layer._weights;
+    layer.blobs["biases"] = layer._biases;
+    auto owned = IE::make_shared_blob<float>(IE::Precision::FP32, IE::C, {2});
+    owned->allocate();
+    layer.blobs["custom"] = owned;
+    ASSERT_EQ(3, buffer.use_count());
+
+    IE::detachLayerBlobs(layer);
+
+    ASSERT_EQ(1, buffer.use_count());
+    ASSERT_EQ(layer._weights, layer.blobs["weights"]);
+    ASSERT_EQ(layer._biases, layer.blobs["biases"]);
+    ASSERT_EQ(owned, layer.blobs["custom"]);
+    ASSERT_EQ(6, layer._weights->size());
+    ASSERT_EQ(0, memcmp(layer._weights->cbuffer(), buffer->cbuffer(), 6 * sizeof(float)));
+    ASSERT_EQ(0, memcmp(layer._biases->cbuffer(), buffer->cbuffer().as<uint8_t *>() + 24, 2 * sizeof(float)));
+}
+
+TEST(UtilTests, foldConstantsMergesScaleShiftIntoConvolution) {
+    //
+    // I->conv->scaleshift->O
+    //
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data1", IE::SizeVector{1, 1, 1, 2}, IE::Precision::FP32, IE::Layout::NCHW)
+               .data("data2", IE::SizeVector{1, 2, 1, 1}, IE::Precision::FP32, IE::Layout::NCHW)
+               .data("data3", IE::SizeVector{1, 2, 1, 1}, IE::Precision::FP32, IE::Layout::NCHW)
+               .layer<IE::ConvolutionLayer>(IE::LayerParams{"conv", "Convolution", IE::Precision::FP32})
+               .layer<IE::ScaleShiftLayer>(IE::LayerParams{"scaleshift", "ScaleShift", IE::Precision::FP32})
+               .linkData("data1", "data2", "conv")
+               .linkData("data2", "data3", "scaleshift")
+               .finalize();
+
+    auto makeBlob = [](std::initializer_list<float> values) {
+        auto blob = IE::make_shared_blob<float>(IE::Precision::FP32, IE::C, {values.size()});
+        blob->allocate();
+        std::copy(values.begin(), values.end(), blob->buffer().as<float *>());
+        return blob;
+    };
+    const auto& layers = netBuilder.getLayersMap();
+    auto conv = std::dynamic_pointer_cast<IE::ConvolutionLayer>(layers.find("conv")->second);
+    auto scaleShift = std::dynamic_pointer_cast<IE::ScaleShiftLayer>(layers.find("scaleshift")->second);
+    conv->_out_depth = 2;
+    auto weights = makeBlob({1.f, 2.f, 3.f, 4.f});
+    conv->_weights = weights;
+    conv->_biases = makeBlob({1.f, 2.f});
+    scaleShift->_weights = makeBlob({2.f, 3.f});
+    scaleShift->_biases = makeBlob({10.f, 20.f});
+
+    ASSERT_EQ(1, IE::foldConstants(*net));
+
+    IE::CNNLayerPtr check;
+    ASSERT_NE(IE::OK, net->getLayerByName("scaleshift", check, nullptr));
+    ASSERT_EQ(nullptr, net->getData("data2"));
+    ASSERT_EQ(1, conv->outData.size());
+    ASSERT_EQ(netBuilder.getDataMap().find("data3")->second, conv->outData[0]);
+    ASSERT_EQ(conv, conv->outData[0]->getCreatorLayer().lock());
+
+    std::vector<float> expectedWeights = {2.f, 4.f, 9.f, 12.f};
+    std::vector<float> expectedBiases = {12.f, 26.f};
+    ASSERT_NE(weights, conv->_weights);
+    ASSERT_EQ(1.f, weights->buffer().as<float *>()[0]);
+    ASSERT_EQ(expectedWeights, std::vector<float>(conv->_weights->cbuffer().as<const float *>(),
+                                                  conv->_weights->cbuffer().as<const float *>() + 4));
+    ASSERT_EQ(expectedBiases, std::vector<float>(conv->_biases->cbuffer().as<const float *>(),
+                                                 conv->_biases->cbuffer().as<const float *>() + 2));
+    ASSERT_EQ(conv->_weights, conv->blobs["weights"]);
+}
+
+TEST(UtilTests, foldConstantsEvaluatesLayersWithConstantInputs) {
+    //
+    // const->power->eltwise->O
+    //              /
+    //             I
+    //
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data1", IE::SizeVector{1, 3}, IE::Precision::FP32, IE::Layout::NC)
+               .data("data2", IE::SizeVector{1, 3}, IE::Precision::FP32, IE::Layout::NC)
+               .data("data3", IE::SizeVector{1, 3}, IE::Precision::FP32, IE::Layout::NC)
+               .data("data4", IE::SizeVector{1, 3}, IE::Precision::FP32, IE::Layout::NC)
+               .layer<IE::CNNLayer>(IE::LayerParams{"const", "Const", IE::Precision::FP32})
+               .layer<IE::PowerLayer>(IE::LayerParams{"power", "Power", IE::Precision::FP32})
+               .layer<IE::EltwiseLayer>(IE::LayerParams{"eltwise", "Eltwise", IE::Precision::FP32})
+               .linkToData("const", "data1")
+               .linkData("data1", "data2", "power")
+               .linkData("data2", "data4", "eltwise")
+               .linkDataTo("data3", "eltwise")
+               .finalize();
+
+    const auto& layers = netBuilder.getLayersMap();
+    auto values = IE::make_shared_blob<float>(IE::Precision::FP32, IE::NC, {1, 3});
+    values->allocate();
+    std::vector<float> input = {1.f, 2.f, 3.f};
+    std::copy(input.begin(), input.end(), values->buffer().as<float *>());
+    layers.find("const")->second->blobs["custom"] = values;
+    auto power = std::dynamic_pointer_cast<IE::PowerLayer>(layers.find("power")->second);
+    power->power = 2.f;
+    power->scale = 2.f;
+    power->offset = 1.f;
+
+    ASSERT_EQ(1, IE::foldConstants(*net));
+
+    IE::CNNLayerPtr check;
+    ASSERT_NE(IE::OK, net->getLayerByName("const", check, nullptr));
+    ASSERT_EQ(IE::OK, net->getLayerByName("power", check, nullptr));
+    ASSERT_EQ("Const", check->type);
+    ASSERT_TRUE(check->insData.empty());
+    ASSERT_EQ(1, check->blobs.size());
+    auto result = check->blobs["custom"];
+    ASSERT_NE(nullptr, result);
+    std::vector<float> expected = {9.f, 25.f, 49.f};
+    ASSERT_EQ(expected, std::vector<float>(result->cbuffer().as<const float *>(),
+                                           result->cbuffer().as<const float *>() + 3));
+    ASSERT_EQ(IE::OK, net->getLayerByName("eltwise", check, nullptr));
+    ASSERT_EQ("Eltwise", check->type);
+}
@@ -5,6 +5,9 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+#include <vector>
+
 #include "memory_solver.hpp"
 #include "details/ie_exception.hpp"
 
@@ -254,3 +257,84 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+namespace {
+
+using Strategy = MemorySolver::Strategy;
+
+bool hasOverlapping(const std::vector<Box> &boxes, const MemorySolver &ms) {
+    for (size_t i = 0; i < boxes.size(); i++)
+    for (size_t j = i+1; j < boxes.size(); j++) {
+        const Box &b1 = boxes[i], &b2 = boxes[j];
+        int off1 = ms.getOffset(b1.id);
+        int off2 = ms.getOffset(b2.id);
+        int f1 = b1.finish == -1 ? INT32_MAX : b1.finish;
+        int f2 = b2.finish == -1 ? INT32_MAX : b2.finish;
+        bool time_overlap = !(f1 < b2.start || b1.start > f2);
+        bool mem_overlap = !(off1 + b1.size <= off2 || off1 >= off2 + b2.size);
+        if (time_overlap && mem_overlap) return true;
+    }
+    return false;
+}
+
+std::vector<Box> randomBoxes(int num, int max_live, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> live(0, max_live);
+    std::uniform_int_distribution<int> size(1, 64);
+    std::vector<Box> boxes;
+    for (int i = 0; i < num; i++)
+        boxes.push_back({i, i + live(gen), size(gen), i});
+    boxes.back().finish = -1;
+    return boxes;
+}
+
+}  // namespace
+
+TEST(MemSolverTest, BestOfAllStrategiesSolvesUnefficiency) {
+    std::vector<Box> boxes{
+            {6, 7, 3, 0},
+            {2, 5, 2, 1},
+            {5, 8, 2, 2},
+            {2, 3, 2, 3},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(Strategy::BEST), 5);
+    EXPECT_EQ(ms.solvedSize(), ms.maxDepth());
+    EXPECT_FALSE(hasOverlapping(boxes, ms));
+}
+
+TEST(MemSolverTest, AllStrategiesGiveValidPacking) {
+    for (unsigned seed = 0; seed < 10; seed++) {
+        auto boxes = randomBoxes(200, 20, seed);
+        MemorySolver ms(boxes);
+        int best = ms.solve(Strategy::BEST);
+        EXPECT_FALSE(hasOverlapping(boxes, ms)) << "seed " << seed;
+
+        for (auto strategy : {Strategy::BY_SIZE, Strategy::BY_LIFETIME, Strategy::BEST_FIT}) {
+            int size = ms.solve(strategy);
+            EXPECT_EQ(size, ms.solvedSize());
+            EXPECT_GE(size, ms.maxDepth());
+            EXPECT_LE(best, size);
+            EXPECT_FALSE(hasOverlapping(boxes, ms)) << "seed " << seed;
+        }
+    }
+}
+
+TEST(MemSolverTest, SolvesLargeGraph) {
+    // Unrolled recurrent topology like: a lot of short living boxes and some long living ones
+    auto boxes = randomBoxes(20000, 4, 0);
+    for (size_t i = 0; i < boxes.size(); i += 100) boxes[i].finish = static_cast<int>(i) + 5000;
+
+    MemorySolver ms(boxes);
+    int size = ms.solve(Strategy::BEST);
+    EXPECT_GE(size, ms.maxDepth());
+    EXPECT_LE(size, 2 * ms.maxDepth());
+}
+
+TEST(MemSolverTest, EmptyBoxes) {
+    MemorySolver ms({});
+    EXPECT_EQ(ms.solvedSize(), -1);
+    EXPECT_EQ(ms.solve(Strategy::BEST), 0);
+    EXPECT_EQ(ms.solvedSize(), 0);
+}
@@ -39,6 +39,8 @@ public:
     MOCK_CONST_METHOD1(GetPerformanceCounts_ThreadUnsafe, void(std::map<std::string, InferenceEngineProfileInfo>
             &));
 
+    MOCK_METHOD0(ResetPerformanceCounts_ThreadUnsafe, void());
+
     MOCK_METHOD2(GetBlob_ThreadUnsafe, void(
             const char *name, Blob::Ptr
             &));
@@ -51,4 +53,5 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+	MOCK_METHOD1(SetConfig_ThreadUnsafe, void(const std::map<std::string, std::string> &));
 };
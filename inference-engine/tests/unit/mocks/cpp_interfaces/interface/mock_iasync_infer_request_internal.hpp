@@ -19,8 +19,10 @@ public:
     MOCK_METHOD1(SetUserData, void(void *));
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
+    MOCK_METHOD0(ResetPerformanceCounts, void());
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+	MOCK_METHOD1(SetConfig, void(const std::map<std::string, std::string> &));
 };
@@ -28,5 +28,6 @@ public:
     MOCK_METHOD1(CreateInferRequest, void(IInferRequest::Ptr &));
     MOCK_METHOD1(Export, void(const std::string &));
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
+    MOCK_METHOD1(GetMemoryInfo, void(MemoryInfo &));
     MOCK_METHOD0(QueryState, std::vector<IMemoryStateInternal::Ptr>());
 };
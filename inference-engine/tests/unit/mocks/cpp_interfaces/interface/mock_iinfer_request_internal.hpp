@@ -16,6 +16,7 @@ class MockIInferRequestInternal : public InferenceEngine::IInferRequestInternal
 public:
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
+    MOCK_METHOD0(ResetPerformanceCounts, void());
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
 };
@@ -26,7 +26,9 @@ public:
     MOCK_QUALIFIED_METHOD1(Infer, noexcept, StatusCode(ResponseDesc*));
     MOCK_QUALIFIED_METHOD2(GetPerformanceCounts, const noexcept,
                            StatusCode(std::map<std::string, InferenceEngineProfileInfo> &perfMap, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD1(ResetPerformanceCounts, noexcept, StatusCode(ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(GetBlob, noexcept, StatusCode(const char*, Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+	MOCK_QUALIFIED_METHOD2(SetConfig, noexcept, StatusCode(const std::map<std::string, std::string> &, ResponseDesc*));
 };